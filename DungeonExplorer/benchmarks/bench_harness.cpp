@@ -0,0 +1,255 @@
+#include "bench_harness.h"
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <new>
+#include <sstream>
+#include <tuple>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+// ---- Allocation counting ----
+// Every replaceable allocation function funnels through countedAlloc, so
+// containers that allocate via std::allocator are counted too.
+
+static std::atomic<uint64_t> allocationCount{0};
+static std::atomic<uint64_t> allocatedBytes{0};
+
+// Per thread as well, so jobs running side by side can each count their own allocations
+static thread_local uint64_t threadAllocationCount = 0;
+static thread_local uint64_t threadAllocatedBytes = 0;
+
+static void countAllocation(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    threadAllocationCount++;
+    threadAllocatedBytes += size;
+}
+
+static void* countedAlloc(std::size_t size) {
+    countAllocation(size);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+static void* countedAlignedAlloc(std::size_t size, std::align_val_t align) {
+    countAllocation(size);
+#if defined(_WIN32)
+    if (void* p = _aligned_malloc(size ? size : 1, static_cast<std::size_t>(align))) return p;
+#else
+    void* p = nullptr;
+    if (posix_memalign(&p, static_cast<std::size_t>(align), size ? size : 1) == 0) return p;
+#endif
+    throw std::bad_alloc();
+}
+
+static void alignedFree(void* p) {
+#if defined(_WIN32)
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+
+void* operator new(std::size_t size) { return countedAlloc(size); }
+void* operator new[](std::size_t size) { return countedAlloc(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try { return countedAlloc(size); } catch (...) { return nullptr; }
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    try { return countedAlloc(size); } catch (...) { return nullptr; }
+}
+void* operator new(std::size_t size, std::align_val_t align) { return countedAlignedAlloc(size, align); }
+void* operator new[](std::size_t size, std::align_val_t align) { return countedAlignedAlloc(size, align); }
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { alignedFree(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { alignedFree(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { alignedFree(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { alignedFree(p); }
+
+AllocationCounters allocationSnapshot() {
+    AllocationCounters counters;
+    counters.allocations = allocationCount.load(std::memory_order_relaxed);
+    counters.bytes = allocatedBytes.load(std::memory_order_relaxed);
+    return counters;
+}
+
+AllocationCounters threadAllocationSnapshot() {
+    AllocationCounters counters;
+    counters.allocations = threadAllocationCount;
+    counters.bytes = threadAllocatedBytes;
+    return counters;
+}
+
+size_t peakRssKb() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS info;
+    if (K32GetProcessMemoryInfo(GetCurrentProcess(), &info, sizeof(info))) {
+        return static_cast<size_t>(info.PeakWorkingSetSize / 1024);
+    }
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#if defined(__APPLE__)
+    return static_cast<size_t>(usage.ru_maxrss / 1024);  // Bytes on macOS
+#else
+    return static_cast<size_t>(usage.ru_maxrss);         // KiB on Linux
+#endif
+#endif
+}
+
+// ---- Options ----
+
+static void usage(const char* program) {
+    std::fprintf(stderr,
+        "Usage: %s [--sizes N,N,...] [--max-size N] [--min-time MS] [--filter TEXT]\n"
+        "          [--json FILE] [--csv FILE] [--compare BASELINE.json]\n", program);
+    std::exit(2);
+}
+
+BenchOptions parseBenchOptions(int argc, char** argv, const char* program, size_t defaultMaxSize) {
+    BenchOptions options;
+    options.maxSize = defaultMaxSize;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> std::string {
+            if (i + 1 >= argc) usage(program);
+            return argv[++i];
+        };
+
+        if (arg == "--sizes") {
+            std::stringstream list(value());
+            std::string item;
+            while (std::getline(list, item, ',')) {
+                if (!item.empty()) options.sizes.push_back(std::stoull(item));
+            }
+        } else if (arg == "--max-size") {
+            options.maxSize = std::stoull(value());
+        } else if (arg == "--min-time") {
+            options.minTimeMs = std::stod(value());
+        } else if (arg == "--filter") {
+            options.filter = value();
+        } else if (arg == "--json") {
+            options.jsonPath = value();
+        } else if (arg == "--csv") {
+            options.csvPath = value();
+        } else if (arg == "--compare") {
+            options.comparePath = value();
+        } else {
+            usage(program);
+        }
+    }
+
+    if (options.sizes.empty()) {
+        for (size_t n = 10; n <= options.maxSize; n *= 10) {
+            options.sizes.push_back(n);
+        }
+    }
+    return options;
+}
+
+// ---- Runner ----
+
+BenchRunner::BenchRunner(BenchOptions opts) : options(std::move(opts)) {
+    std::printf("%-12s %-18s %-16s %10s %12s %10s %12s %10s\n",
+                "suite", "case", "impl", "n", "ns/op", "allocs/op", "bytes/op", "rss KiB");
+}
+
+std::vector<size_t> BenchRunner::sizes(size_t limit) const {
+    std::vector<size_t> result;
+    for (size_t n : options.sizes) {
+        if (n <= limit) result.push_back(n);
+    }
+    return result;
+}
+
+bool BenchRunner::selected(const std::string& suite, const std::string& name, const std::string& impl) const {
+    if (options.filter.empty()) return true;
+    return (suite + "/" + name + "/" + impl).find(options.filter) != std::string::npos;
+}
+
+void BenchRunner::record(BenchResult result) {
+    std::printf("%-12s %-18s %-16s %10zu %12.2f %10.3f %12.1f %10zu\n",
+                result.suite.c_str(), result.name.c_str(), result.impl.c_str(), result.n,
+                result.nsPerOp, result.allocsPerOp, result.bytesPerOp, result.peakRssKb);
+    std::fflush(stdout);
+    results.push_back(std::move(result));
+}
+
+int BenchRunner::finish() {
+    if (!options.jsonPath.empty()) {
+        std::ofstream out(options.jsonPath);
+        if (!out) {
+            std::cerr << "[Bench] Cannot write " << options.jsonPath << std::endl;
+            return 1;
+        }
+        // One result per line so baselines diff cleanly
+        out << "{\"results\": [\n";
+        for (size_t i = 0; i < results.size(); i++) {
+            const BenchResult& r = results[i];
+            nlohmann::ordered_json row = {
+                {"suite", r.suite}, {"name", r.name}, {"impl", r.impl}, {"n", r.n},
+                {"iterations", r.iterations}, {"ns_per_op", r.nsPerOp},
+                {"allocs_per_op", r.allocsPerOp}, {"bytes_per_op", r.bytesPerOp},
+                {"peak_rss_kb", r.peakRssKb},
+            };
+            out << "  " << row.dump() << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+        out << "]}\n";
+    }
+
+    if (!options.csvPath.empty()) {
+        std::ofstream out(options.csvPath);
+        if (!out) {
+            std::cerr << "[Bench] Cannot write " << options.csvPath << std::endl;
+            return 1;
+        }
+        out << "suite,name,impl,n,iterations,ns_per_op,allocs_per_op,bytes_per_op,peak_rss_kb\n";
+        for (const BenchResult& r : results) {
+            out << r.suite << ',' << r.name << ',' << r.impl << ',' << r.n << ',' << r.iterations << ','
+                << r.nsPerOp << ',' << r.allocsPerOp << ',' << r.bytesPerOp << ',' << r.peakRssKb << '\n';
+        }
+    }
+
+    if (!options.comparePath.empty()) {
+        std::ifstream in(options.comparePath);
+        nlohmann::json baseline = nlohmann::json::parse(in, nullptr, false);
+        if (baseline.is_discarded() || !baseline.contains("results")) {
+            std::cerr << "[Bench] Cannot read baseline " << options.comparePath << std::endl;
+            return 1;
+        }
+
+        using Key = std::tuple<std::string, std::string, std::string, size_t>;
+        std::map<Key, double> baselineNs;
+        for (const auto& row : baseline["results"]) {
+            baselineNs[Key{row["suite"], row["name"], row["impl"], row["n"]}] = row["ns_per_op"];
+        }
+
+        std::printf("\nCompared with %s (ratio > 1 is slower than baseline):\n", options.comparePath.c_str());
+        for (const BenchResult& r : results) {
+            auto it = baselineNs.find(Key{r.suite, r.name, r.impl, r.n});
+            if (it == baselineNs.end() || it->second <= 0.0) continue;
+            std::printf("  %-12s %-18s %-16s %10zu %8.2fx\n",
+                        r.suite.c_str(), r.name.c_str(), r.impl.c_str(), r.n, r.nsPerOp / it->second);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,124 @@
+// Minimal benchmark harness shared by the headless benchmark executables.
+// - Repeats a body until it has run for at least --min-time, reports ns/op
+// - Counts heap allocations (global operator new is replaced in bench_harness.cpp)
+// - Samples peak RSS of the process after each case
+// - Writes results as JSON and/or CSV and compares against a baseline JSON file
+//
+// Common options:
+//   --sizes 10,1000,...   element counts to run (default: powers of ten up to --max-size)
+//   --max-size N          largest default size
+//   --min-time MS         minimum measured time per case (default 100)
+//   --filter TEXT         only cases whose "suite/name/impl" contains TEXT
+//   --json FILE  --csv FILE
+//   --compare FILE        print the ratio to a baseline written with --json
+
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct AllocationCounters {
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+};
+
+// Totals since program start
+AllocationCounters allocationSnapshot();
+
+// Totals of the calling thread since it started: exact for work that stays on one thread
+AllocationCounters threadAllocationSnapshot();
+
+// Peak resident set size of this process in KiB (0 where unsupported)
+size_t peakRssKb();
+
+// Keep the optimizer from discarding a computed value
+template<typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    volatile const void* sink = &value;
+    (void)sink;
+#endif
+}
+
+struct BenchResult {
+    std::string suite;     // Container family, e.g. "hashtable"
+    std::string name;      // Operation, e.g. "lookup_hit"
+    std::string impl;      // "dsa" container or its std baseline
+    size_t n = 0;
+    uint64_t iterations = 0;
+    double nsPerOp = 0.0;
+    double allocsPerOp = 0.0;
+    double bytesPerOp = 0.0;
+    size_t peakRssKb = 0;
+};
+
+struct BenchOptions {
+    std::vector<size_t> sizes;
+    size_t maxSize = 1000000;
+    double minTimeMs = 100.0;
+    std::string filter;
+    std::string jsonPath;
+    std::string csvPath;
+    std::string comparePath;
+};
+
+// Parses the common options; exits with usage on unknown arguments.
+BenchOptions parseBenchOptions(int argc, char** argv, const char* program, size_t defaultMaxSize);
+
+class BenchRunner {
+public:
+    explicit BenchRunner(BenchOptions options);
+
+    // Sizes to run for a case that tops out at 'limit' elements
+    std::vector<size_t> sizes(size_t limit = static_cast<size_t>(-1)) const;
+
+    bool selected(const std::string& suite, const std::string& name, const std::string& impl) const;
+
+    // Time body() (which performs opsPerCall operations) until minTimeMs has elapsed.
+    // Setup belongs outside; body should doNotOptimize() its results.
+    template<typename F>
+    void run(const std::string& suite, const std::string& name, const std::string& impl,
+             size_t n, double opsPerCall, F&& body) {
+        if (!selected(suite, name, impl)) return;
+
+        body();  // Warm-up: caches, lazy scratch buffers, page faults
+
+        using Clock = std::chrono::steady_clock;
+        const AllocationCounters before = allocationSnapshot();
+        const Clock::time_point start = Clock::now();
+        uint64_t iterations = 0;
+        double elapsedNs = 0.0;
+        do {
+            body();
+            iterations++;
+            elapsedNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        } while (elapsedNs < options.minTimeMs * 1e6);
+        const AllocationCounters after = allocationSnapshot();
+
+        const double ops = opsPerCall * static_cast<double>(iterations);
+        BenchResult result;
+        result.suite = suite;
+        result.name = name;
+        result.impl = impl;
+        result.n = n;
+        result.iterations = iterations;
+        result.nsPerOp = elapsedNs / ops;
+        result.allocsPerOp = static_cast<double>(after.allocations - before.allocations) / ops;
+        result.bytesPerOp = static_cast<double>(after.bytes - before.bytes) / ops;
+        result.peakRssKb = peakRssKb();
+        record(std::move(result));
+    }
+
+    // Write JSON/CSV, print the baseline comparison. Returns the process exit code.
+    int finish();
+
+private:
+    BenchOptions options;
+    std::vector<BenchResult> results;
+
+    void record(BenchResult result);
+};
@@ -0,0 +1,419 @@
+// Microbenchmarks for every DataStructures template against its std equivalent.
+// Run before and after a container change and diff with --compare:
+//
+//   dsa_bench --json after.json --compare ../benchmarks/baseline.json
+//
+// Each case reports ns/op, heap allocations/op, bytes allocated/op and the
+// process peak RSS after the case. See bench_harness.h for all options.
+
+#include "bench_harness.h"
+#include "DataStructures/Stack.h"
+#include "DataStructures/Queue.h"
+#include "DataStructures/SpscQueue.h"
+#include "DataStructures/LinkedList.h"
+#include "DataStructures/Heap.h"
+#include "DataStructures/HashTable.h"
+#include "DataStructures/Graph.h"
+#include "DataStructures/Tree.h"
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+static constexpr size_t GRAPH_MAX_VERTICES = 1000000;
+
+static std::vector<int> randomInts(size_t n, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::vector<int> values(n);
+    for (int& v : values) v = static_cast<int>(rng() >> 1);
+    return values;
+}
+
+// n distinct even keys in random order (odd keys are guaranteed misses)
+static std::vector<int> distinctKeys(size_t n, uint32_t seed) {
+    std::vector<int> keys(n);
+    for (size_t i = 0; i < n; i++) {
+        keys[i] = static_cast<int>((static_cast<uint32_t>(i) * 2654435761u) & 0x3FFFFFFFu) * 2;
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(seed));
+    return keys;
+}
+
+// ---- Stack / Queue ----
+
+static void benchStack(BenchRunner& runner) {
+    for (size_t n : runner.sizes()) {
+        runner.run("stack", "push_pop", "dsa", n, 2.0 * n, [&] {
+            Stack<int, NoTrace> stack;
+            for (size_t i = 0; i < n; i++) stack.push(static_cast<int>(i));
+            long long sum = 0;
+            while (!stack.isEmpty()) { sum += stack.top(); stack.pop(); }
+            doNotOptimize(sum);
+        });
+        runner.run("stack", "push_pop", "std-vector", n, 2.0 * n, [&] {
+            std::vector<int> stack;
+            for (size_t i = 0; i < n; i++) stack.push_back(static_cast<int>(i));
+            long long sum = 0;
+            while (!stack.empty()) { sum += stack.back(); stack.pop_back(); }
+            doNotOptimize(sum);
+        });
+    }
+}
+
+static void benchQueue(BenchRunner& runner) {
+    for (size_t n : runner.sizes()) {
+        runner.run("queue", "enqueue_dequeue", "dsa", n, 2.0 * n, [&] {
+            Queue<int, NoTrace> queue;
+            for (size_t i = 0; i < n; i++) queue.enqueue(static_cast<int>(i));
+            long long sum = 0;
+            while (!queue.isEmpty()) { sum += queue.front(); queue.dequeue(); }
+            doNotOptimize(sum);
+        });
+        runner.run("queue", "enqueue_dequeue", "dsa-spsc", n, 2.0 * n, [&] {
+            SpscQueue<int> queue(n);
+            for (size_t i = 0; i < n; i++) queue.try_enqueue(static_cast<int>(i));
+            long long sum = 0;
+            int value;
+            while (queue.try_dequeue(value)) sum += value;
+            doNotOptimize(sum);
+        });
+        runner.run("queue", "enqueue_dequeue", "std-deque", n, 2.0 * n, [&] {
+            std::deque<int> queue;
+            for (size_t i = 0; i < n; i++) queue.push_back(static_cast<int>(i));
+            long long sum = 0;
+            while (!queue.empty()) { sum += queue.front(); queue.pop_front(); }
+            doNotOptimize(sum);
+        });
+    }
+}
+
+// ---- LinkedList ----
+
+static void benchLinkedList(BenchRunner& runner) {
+    for (size_t n : runner.sizes()) {
+        runner.run("linkedlist", "append", "dsa", n, static_cast<double>(n), [&] {
+            LinkedList<int, NoTrace> list;
+            for (size_t i = 0; i < n; i++) list.append(static_cast<int>(i));
+            doNotOptimize(list.back());
+        });
+        runner.run("linkedlist", "append", "std-vector", n, static_cast<double>(n), [&] {
+            std::vector<int> list;
+            for (size_t i = 0; i < n; i++) list.push_back(static_cast<int>(i));
+            doNotOptimize(list.back());
+        });
+
+        LinkedList<int, NoTrace> list;
+        std::vector<int> vec;
+        for (size_t i = 0; i < n; i++) {
+            list.append(static_cast<int>(i));
+            vec.push_back(static_cast<int>(i));
+        }
+        runner.run("linkedlist", "traverse", "dsa", n, static_cast<double>(n), [&] {
+            long long sum = 0;
+            list.traverse([&](int v) { sum += v; });
+            doNotOptimize(sum);
+        });
+        runner.run("linkedlist", "traverse", "std-vector", n, static_cast<double>(n), [&] {
+            long long sum = 0;
+            for (int v : vec) sum += v;
+            doNotOptimize(sum);
+        });
+    }
+}
+
+// ---- Heap ----
+
+template<size_t Arity>
+static void heapPushPop(const std::vector<int>& values) {
+    Heap<int, std::greater<int>, Arity, NoTrace> heap;
+    heap.reserve(values.size());
+    for (int v : values) heap.insert(v);
+    long long sum = 0;
+    while (!heap.isEmpty()) sum += heap.extractTop();
+    doNotOptimize(sum);
+}
+
+static void benchHeap(BenchRunner& runner) {
+    for (size_t n : runner.sizes()) {
+        const std::vector<int> values = randomInts(n, 7);
+        runner.run("heap", "push_pop", "dsa-binary", n, 2.0 * n, [&] { heapPushPop<2>(values); });
+        runner.run("heap", "push_pop", "dsa-4ary", n, 2.0 * n, [&] { heapPushPop<4>(values); });
+        runner.run("heap", "push_pop", "std-pq", n, 2.0 * n, [&] {
+            std::vector<int> storage;
+            storage.reserve(n);
+            std::priority_queue<int, std::vector<int>, std::greater<int>> heap(std::greater<int>(), std::move(storage));
+            for (int v : values) heap.push(v);
+            long long sum = 0;
+            while (!heap.empty()) { sum += heap.top(); heap.pop(); }
+            doNotOptimize(sum);
+        });
+    }
+}
+
+// ---- HashTable ----
+
+static void benchHashTable(BenchRunner& runner) {
+    for (size_t n : runner.sizes()) {
+        const std::vector<int> keys = distinctKeys(n, 11);
+        std::vector<int> misses = distinctKeys(n, 13);
+        for (int& k : misses) k |= 1;
+
+        runner.run("hashtable", "insert", "dsa", n, static_cast<double>(n), [&] {
+            HashTable<int, int, NoTrace> table;
+            for (int k : keys) table.insert(k, k);
+            doNotOptimize(table.size());
+        });
+        runner.run("hashtable", "insert", "std-unordered", n, static_cast<double>(n), [&] {
+            std::unordered_map<int, int> table;
+            for (int k : keys) table.emplace(k, k);
+            doNotOptimize(table.size());
+        });
+
+        HashTable<int, int, NoTrace> table;
+        std::unordered_map<int, int> stdTable;
+        for (int k : keys) {
+            table.insert(k, k);
+            stdTable.emplace(k, k);
+        }
+        runner.run("hashtable", "lookup_hit", "dsa", n, static_cast<double>(n), [&] {
+            long long sum = 0;
+            for (int k : keys) sum += *table.find(k);
+            doNotOptimize(sum);
+        });
+        runner.run("hashtable", "lookup_hit", "std-unordered", n, static_cast<double>(n), [&] {
+            long long sum = 0;
+            for (int k : keys) sum += stdTable.find(k)->second;
+            doNotOptimize(sum);
+        });
+        runner.run("hashtable", "lookup_miss", "dsa", n, static_cast<double>(n), [&] {
+            size_t found = 0;
+            for (int k : misses) found += table.contains(k);
+            doNotOptimize(found);
+        });
+        runner.run("hashtable", "lookup_miss", "std-unordered", n, static_cast<double>(n), [&] {
+            size_t found = 0;
+            for (int k : misses) found += stdTable.count(k);
+            doNotOptimize(found);
+        });
+
+        // String keys, like the item and texture tables
+        std::vector<std::string> names(n);
+        for (size_t i = 0; i < n; i++) names[i] = "item_" + std::to_string(keys[i]);
+        HashTable<std::string, int, NoTrace> stringTable;
+        std::unordered_map<std::string, int> stdStringTable;
+        for (size_t i = 0; i < n; i++) {
+            stringTable.insert(names[i], static_cast<int>(i));
+            stdStringTable.emplace(names[i], static_cast<int>(i));
+        }
+        runner.run("hashtable", "string_lookup", "dsa", n, static_cast<double>(n), [&] {
+            long long sum = 0;
+            for (const std::string& name : names) sum += *stringTable.find(name);
+            doNotOptimize(sum);
+        });
+        runner.run("hashtable", "string_lookup", "std-unordered", n, static_cast<double>(n), [&] {
+            long long sum = 0;
+            for (const std::string& name : names) sum += stdStringTable.find(name)->second;
+            doNotOptimize(sum);
+        });
+    }
+}
+
+// ---- Graph ----
+
+using BenchGraph = Graph<int, NoTrace>;
+using Adjacency = std::vector<std::vector<std::pair<int, int>>>;  // (target, weight)
+
+struct GraphFixture {
+    BenchGraph graph;
+    Adjacency adjacency;
+
+    explicit GraphFixture(size_t n) : adjacency(n) {
+        for (size_t v = 0; v < n; v++) graph.addVertex(static_cast<int>(v));
+    }
+
+    void addEdge(int a, int b, int weight) {
+        graph.addBidirectionalEdge(a, b, weight);
+        adjacency[a].emplace_back(b, weight);
+        adjacency[b].emplace_back(a, weight);
+    }
+};
+
+// 4-connected grid with small weights (corridor lengths)
+static void buildGrid(GraphFixture& fixture, int width, int height) {
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<int> weight(1, 9);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            int v = y * width + x;
+            if (x + 1 < width) fixture.addEdge(v, v + 1, weight(rng));
+            if (y + 1 < height) fixture.addEdge(v, v + width, weight(rng));
+        }
+    }
+    fixture.graph.freeze();
+}
+
+// Ring (so everything is reachable) plus ~3 random chords per vertex
+static void buildRandom(GraphFixture& fixture, int n) {
+    std::mt19937 rng(54321);
+    std::uniform_int_distribution<int> vertex(0, n - 1);
+    std::uniform_int_distribution<int> weight(1, 9);
+    for (int v = 0; v < n; v++) {
+        if (n > 1) fixture.addEdge(v, (v + 1) % n, weight(rng));
+        for (int k = 0; k < 3; k++) fixture.addEdge(v, vertex(rng), weight(rng));
+    }
+    fixture.graph.freeze();
+}
+
+static size_t stdBfs(const Adjacency& adjacency, int start) {
+    std::vector<char> visited(adjacency.size(), 0);
+    std::deque<int> frontier{start};
+    visited[start] = 1;
+    size_t count = 0;
+    while (!frontier.empty()) {
+        int current = frontier.front();
+        frontier.pop_front();
+        count++;
+        for (auto [next, w] : adjacency[current]) {
+            if (!visited[next]) {
+                visited[next] = 1;
+                frontier.push_back(next);
+            }
+        }
+    }
+    return count;
+}
+
+static long long stdDijkstra(const Adjacency& adjacency, int start) {
+    std::vector<int> dist(adjacency.size(), std::numeric_limits<int>::max());
+    using Entry = std::pair<int, int>;  // (distance, vertex)
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> frontier;
+    dist[start] = 0;
+    frontier.emplace(0, start);
+    while (!frontier.empty()) {
+        auto [d, current] = frontier.top();
+        frontier.pop();
+        if (d > dist[current]) continue;
+        for (auto [next, w] : adjacency[current]) {
+            if (d + w < dist[next]) {
+                dist[next] = d + w;
+                frontier.emplace(d + w, next);
+            }
+        }
+    }
+    return dist.back();
+}
+
+static void benchGraphShape(BenchRunner& runner, const std::string& shape, GraphFixture& fixture, size_t n) {
+    const double ops = static_cast<double>(fixture.graph.vertexCount());
+
+    runner.run("graph", shape + "_bfs", "dsa", n, ops, [&] { doNotOptimize(fixture.graph.bfs(0).size()); });
+    runner.run("graph", shape + "_bfs", "std", n, ops, [&] { doNotOptimize(stdBfs(fixture.adjacency, 0)); });
+    runner.run("graph", shape + "_dfs", "dsa", n, ops, [&] { doNotOptimize(fixture.graph.dfs(0).size()); });
+
+    const struct {
+        const char* impl;
+        BenchGraph::QueueKind kind;
+    } kinds[] = {
+        {"dsa-lazy", BenchGraph::QueueKind::LazyBinary},
+        {"dsa-indexed", BenchGraph::QueueKind::Indexed},
+        {"dsa-radix", BenchGraph::QueueKind::Radix},
+    };
+    for (const auto& k : kinds) {
+        fixture.graph.setQueueKind(k.kind);
+        runner.run("graph", shape + "_dijkstra", k.impl, n, ops, [&] {
+            doNotOptimize(fixture.graph.shortestPathTree(0).distance.back());
+        });
+    }
+    runner.run("graph", shape + "_dijkstra", "std-pq", n, ops, [&] {
+        doNotOptimize(stdDijkstra(fixture.adjacency, 0));
+    });
+}
+
+static void benchGraph(BenchRunner& runner) {
+    for (size_t n : runner.sizes(GRAPH_MAX_VERTICES)) {
+        const int side = std::max(2, static_cast<int>(std::sqrt(static_cast<double>(n))));
+        GraphFixture grid(static_cast<size_t>(side) * side);
+        buildGrid(grid, side, side);
+        benchGraphShape(runner, "grid", grid, n);
+
+        GraphFixture random(n);
+        buildRandom(random, static_cast<int>(n));
+        benchGraphShape(runner, "random", random, n);
+    }
+}
+
+// ---- BinaryTree ----
+
+// Random binary tree: each node hangs off a random node that still has a free child slot
+static void buildRandomTree(BinaryTree<int, NoTrace>& tree, size_t n) {
+    std::mt19937 rng(99);
+    tree.reserve(n);
+    std::vector<BinaryTree<int, NoTrace>::Handle> open{tree.setRoot(0)};
+    for (size_t i = 1; i < n; i++) {
+        size_t pick = rng() % open.size();
+        auto parent = open[pick];
+        bool goLeft = tree.left(parent) == BinaryTree<int, NoTrace>::INVALID_HANDLE &&
+                      (tree.right(parent) != BinaryTree<int, NoTrace>::INVALID_HANDLE || (rng() & 1));
+        auto child = goLeft ? tree.insertLeft(parent, static_cast<int>(i))
+                            : tree.insertRight(parent, static_cast<int>(i));
+        if (tree.left(parent) != BinaryTree<int, NoTrace>::INVALID_HANDLE &&
+            tree.right(parent) != BinaryTree<int, NoTrace>::INVALID_HANDLE) {
+            open[pick] = open.back();
+            open.pop_back();
+        }
+        open.push_back(child);
+    }
+}
+
+static void benchTree(BenchRunner& runner) {
+    for (size_t n : runner.sizes()) {
+        runner.run("tree", "build", "dsa", n, static_cast<double>(n), [&] {
+            BinaryTree<int, NoTrace> tree;
+            buildRandomTree(tree, n);
+            doNotOptimize(tree.size());
+        });
+
+        BinaryTree<int, NoTrace> tree;
+        buildRandomTree(tree, n);
+        std::vector<int> flat(n);
+        for (size_t i = 0; i < n; i++) flat[i] = static_cast<int>(i);
+
+        const double ops = static_cast<double>(n);
+        auto sumWith = [&](auto traversal) {
+            long long sum = 0;
+            traversal([&](int v) { sum += v; });
+            doNotOptimize(sum);
+        };
+        runner.run("tree", "preorder", "dsa", n, ops, [&] { sumWith([&](auto f) { tree.preorder(f); }); });
+        runner.run("tree", "inorder", "dsa", n, ops, [&] { sumWith([&](auto f) { tree.inorder(f); }); });
+        runner.run("tree", "postorder", "dsa", n, ops, [&] { sumWith([&](auto f) { tree.postorder(f); }); });
+        runner.run("tree", "level_order", "dsa", n, ops, [&] { sumWith([&](auto f) { tree.levelOrder(f); }); });
+        runner.run("tree", "for_each", "dsa", n, ops, [&] {
+            sumWith([&](auto f) { static_cast<const BinaryTree<int, NoTrace>&>(tree).forEach(f); });
+        });
+        runner.run("tree", "for_each", "std-vector", n, ops, [&] {
+            sumWith([&](auto f) { for (int v : flat) f(v); });
+        });
+    }
+}
+
+int main(int argc, char** argv) {
+    BenchRunner runner(parseBenchOptions(argc, argv, "dsa_bench", 1000000));
+
+    benchStack(runner);
+    benchQueue(runner);
+    benchLinkedList(runner);
+    benchHeap(runner);
+    benchHashTable(runner);
+    benchGraph(runner);
+    benchTree(runner);
+
+    return runner.finish();
+}
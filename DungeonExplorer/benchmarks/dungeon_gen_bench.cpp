@@ -0,0 +1,520 @@
+// Headless dungeon-generation benchmark.
+// Generates floors on every core without a window and reports, per configuration:
+//   speed    latency percentiles per floor, floors/s, rooms/s, tiles/s, allocations per floor
+//   quality  stairs path length, dead-end tiles, rooms cut off from the entrance, doors
+//
+// Two modes:
+//   layout  Dungeon::generate() for each generator and map size (--generators, --sizes)
+//   level   DungeonLevelManager::buildLevel() (what generateLevel() runs) for floors 1..10,
+//           spawns included; the run seed is global, so floors of one seed run in parallel.
+//           Floors of different sizes share a batch, so their rates come from each floor's
+//           own time (one thread), where layout mode divides by the batch's wall time.
+//
+// Allocations are counted per floor on the thread that built it.
+//
+// Level mode can keep its floors as FloorSnapshot files (--save-floors) and later time
+// restoring exactly those floors instead of building them (--load-floors, reported as
+// mode "load"). The quality columns of a load run must match the run that saved it.
+//
+// Options:
+//   --mode layout|level|all   (default all)
+//   --seeds N                 floors per configuration, or runs in level mode (default 32)
+//   --first-seed S            seed of the first floor (default 1)
+//   --threads N               worker threads (default: every core)
+//   --generators a,b,...      layout generators (default classic,bsp,scatter,cave)
+//   --sizes WxH,...           layout map sizes (default 64x64,256x256)
+//   --rooms N                 rooms per layout (default: one per 1024 tiles, at least 8)
+//   --levels FILE             level table for level mode (default assets/data/levels.json)
+//   --save-floors DIR         level mode: also write every floor built to DIR
+//   --load-floors DIR         level mode: restore the floors in DIR instead of building them
+//                             (use the --seeds/--first-seed they were saved with)
+//   --json FILE  --compare BASELINE.json
+//   --verbose                 keep the generators' log output
+
+#include "bench_harness.h"
+#include "Dungeon.h"
+#include "DungeonLevelManager.h"
+#include "Enemy.h"
+#include "Loot.h"
+#include "Random.h"
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+struct GenOptions {
+    std::string mode = "all";
+    size_t seeds = 32;
+    uint64_t firstSeed = 1;
+    unsigned threads = 0;
+    std::vector<std::string> generators = {"classic", "bsp", "scatter", "cave"};
+    std::vector<std::pair<int, int>> sizes = {{64, 64}, {256, 256}};
+    int rooms = 0;
+    std::string levelsPath = "assets/data/levels.json";
+    std::string saveFloorsDir;
+    std::string loadFloorsDir;
+    std::string jsonPath;
+    std::string comparePath;
+    bool verbose = false;
+};
+
+// One generated floor
+struct FloorSample {
+    double ns = 0.0;          // generate()/buildLevel() alone
+    uint64_t allocations = 0; // Made by that call
+    uint64_t bytes = 0;
+    size_t rooms = 0;
+    size_t tiles = 0;
+    int stairsPath = -1;      // Steps from the entrance to the stairs, -1 when unreachable
+    size_t deadEnds = 0;      // Walkable tiles with exactly one walkable neighbour
+    size_t unreachableRooms = 0;
+    size_t doors = 0;
+    size_t enemies = 0;
+};
+
+struct GenResult {
+    std::string mode;
+    std::string config;       // Generator and size, or floor number
+    size_t floors = 0;
+    double p50Ms = 0.0, p90Ms = 0.0, p99Ms = 0.0, maxMs = 0.0;
+    double floorsPerSec = 0.0;
+    double roomsPerSec = 0.0;
+    double tilesPerSec = 0.0;
+    double allocsPerFloor = 0.0;
+    double bytesPerFloor = 0.0;
+    double stairsPath = 0.0;  // Mean over floors whose stairs are reachable
+    size_t stairsUnreachable = 0;
+    double deadEnds = 0.0;
+    double unreachableRooms = 0.0;
+    double doors = 0.0;
+    double enemies = 0.0;
+    size_t peakRssKb = 0;
+};
+
+static void usage(const char* program) {
+    std::fprintf(stderr,
+        "Usage: %s [--mode layout|level|all] [--seeds N] [--first-seed S] [--threads N]\n"
+        "          [--generators a,b,...] [--sizes WxH,...] [--rooms N] [--levels FILE]\n"
+        "          [--save-floors DIR | --load-floors DIR]\n"
+        "          [--json FILE] [--compare BASELINE.json] [--verbose]\n", program);
+    std::exit(2);
+}
+
+static std::vector<std::string> splitList(const std::string& text) {
+    std::vector<std::string> items;
+    std::stringstream list(text);
+    std::string item;
+    while (std::getline(list, item, ',')) {
+        if (!item.empty()) items.push_back(item);
+    }
+    return items;
+}
+
+static GenOptions parseOptions(int argc, char** argv) {
+    GenOptions options;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> std::string {
+            if (i + 1 >= argc) usage(argv[0]);
+            return argv[++i];
+        };
+
+        if (arg == "--mode") {
+            options.mode = value();
+            if (options.mode != "layout" && options.mode != "level" && options.mode != "all") usage(argv[0]);
+        } else if (arg == "--seeds") {
+            options.seeds = std::stoull(value());
+        } else if (arg == "--first-seed") {
+            options.firstSeed = std::stoull(value());
+        } else if (arg == "--threads") {
+            options.threads = static_cast<unsigned>(std::stoul(value()));
+        } else if (arg == "--generators") {
+            options.generators = splitList(value());
+        } else if (arg == "--sizes") {
+            options.sizes.clear();
+            for (const std::string& item : splitList(value())) {
+                const size_t x = item.find('x');
+                if (x == std::string::npos) usage(argv[0]);
+                options.sizes.push_back({std::stoi(item.substr(0, x)), std::stoi(item.substr(x + 1))});
+            }
+        } else if (arg == "--rooms") {
+            options.rooms = std::stoi(value());
+        } else if (arg == "--levels") {
+            options.levelsPath = value();
+        } else if (arg == "--save-floors") {
+            options.saveFloorsDir = value();
+        } else if (arg == "--load-floors") {
+            options.loadFloorsDir = value();
+        } else if (arg == "--json") {
+            options.jsonPath = value();
+        } else if (arg == "--compare") {
+            options.comparePath = value();
+        } else if (arg == "--verbose") {
+            options.verbose = true;
+        } else {
+            usage(argv[0]);
+        }
+    }
+
+    if (!options.saveFloorsDir.empty() && !options.loadFloorsDir.empty()) usage(argv[0]);
+    if (options.threads == 0) {
+        options.threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    return options;
+}
+
+// ---- Running jobs on every core ----
+
+// Run job(i) for i in [0, count) on up to 'threads' threads; returns the wall time in ns
+template<typename F>
+static double runParallel(size_t count, unsigned threads, F&& job) {
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point start = Clock::now();
+
+    std::atomic<size_t> next{0};
+    auto worker = [&] {
+        for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+            job(i);
+        }
+    };
+    const unsigned extra = static_cast<unsigned>(std::min<size_t>(threads, count)) - 1;
+    std::vector<std::thread> pool;
+    pool.reserve(extra);
+    for (unsigned t = 0; t < extra; t++) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (std::thread& thread : pool) {
+        thread.join();
+    }
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+// Floors are built a batch at a time: the generation pass is timed with nothing else
+// running, then the quality pass measures the same floors and hands each one to keep()
+// (e.g. to save it) before the batch is dropped
+struct BatchTotals {
+    double wallNs = 0.0;  // Time the rates are computed over
+};
+
+template<typename Generate, typename Keep>
+static void runBatch(std::vector<FloorSample>& samples, size_t first, size_t count, unsigned threads,
+                     BatchTotals& totals, Generate&& generate, Keep&& keep) {
+    std::vector<std::unique_ptr<Dungeon>> floors(count);
+    std::vector<std::unique_ptr<EnemyManager>> enemies(count);
+    for (size_t i = 0; i < count; i++) {
+        floors[i] = std::make_unique<Dungeon>();
+        enemies[i] = std::make_unique<EnemyManager>();
+    }
+
+    totals.wallNs += runParallel(count, threads, [&](size_t i) {
+        FloorSample& sample = samples[first + i];
+        const AllocationCounters before = threadAllocationSnapshot();
+        const auto start = std::chrono::steady_clock::now();
+        generate(first + i, *floors[i], *enemies[i]);
+        sample.ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        const AllocationCounters after = threadAllocationSnapshot();
+        sample.allocations = after.allocations - before.allocations;
+        sample.bytes = after.bytes - before.bytes;
+    });
+
+    runParallel(count, threads, [&](size_t i) {
+        const Dungeon& dungeon = *floors[i];
+        keep(first + i, dungeon, *enemies[i]);
+        FloorSample& sample = samples[first + i];
+        sample.rooms = dungeon.getRooms().size();
+        sample.tiles = static_cast<size_t>(dungeon.getWidth()) * dungeon.getHeight();
+        sample.doors = dungeon.getDoors().size();
+        sample.enemies = enemies[i]->getEnemies().size();
+
+        // Dead ends: walkable tiles with a single walkable 4-neighbour
+        for (int y = 0; y < dungeon.getHeight(); y++) {
+            for (int x = 0; x < dungeon.getWidth(); x++) {
+                if (!dungeon.isWalkable(x, y)) continue;
+                const int open = dungeon.isWalkable(x - 1, y) + dungeon.isWalkable(x + 1, y) +
+                                 dungeon.isWalkable(x, y - 1) + dungeon.isWalkable(x, y + 1);
+                sample.deadEnds += open == 1;
+            }
+        }
+
+        if (dungeon.getRooms().empty()) return;
+
+        // A room is reachable if any of its tiles shares the entrance's region
+        auto regionOfRoom = [&](const Room& room, int wanted) {
+            int found = -1;
+            for (int y = room.y; y < room.y + room.height; y++) {
+                for (int x = room.x; x < room.x + room.width; x++) {
+                    const int region = dungeon.getRegionAt(x, y);
+                    if (region < 0) continue;
+                    if (wanted < 0 || region == wanted) return region;
+                    found = region;
+                }
+            }
+            return wanted < 0 ? found : -1;
+        };
+        const Room& entrance = dungeon.getRooms().front();
+        const int entranceRegion = regionOfRoom(entrance, -1);
+        for (const Room& room : dungeon.getRooms()) {
+            if (entranceRegion < 0 || regionOfRoom(room, entranceRegion) != entranceRegion) {
+                sample.unreachableRooms++;
+            }
+        }
+
+        if (dungeon.getStairsRoomId() >= 0) {
+            std::vector<std::pair<int, int>> path;
+            const int startX = entrance.x + entrance.width / 2;
+            const int startY = entrance.y + entrance.height / 2;
+            if (dungeon.findPath(startX, startY, dungeon.getStairsX(), dungeon.getStairsY(), path)) {
+                sample.stairsPath = static_cast<int>(path.size());
+            }
+        }
+    });
+}
+
+static GenResult summarize(const std::string& mode, const std::string& config,
+                           std::vector<FloorSample>& samples, const BatchTotals& totals) {
+    GenResult result;
+    result.mode = mode;
+    result.config = config;
+    result.floors = samples.size();
+    if (samples.empty()) return result;
+
+    std::vector<double> latencies;
+    latencies.reserve(samples.size());
+    size_t rooms = 0, tiles = 0, reachable = 0;
+    uint64_t allocations = 0, bytes = 0;
+    double pathSum = 0.0;
+    for (const FloorSample& sample : samples) {
+        latencies.push_back(sample.ns);
+        rooms += sample.rooms;
+        tiles += sample.tiles;
+        allocations += sample.allocations;
+        bytes += sample.bytes;
+        if (sample.stairsPath >= 0) {
+            pathSum += sample.stairsPath;
+            reachable++;
+        } else if (sample.rooms > 1) {
+            result.stairsUnreachable++;
+        }
+        result.deadEnds += static_cast<double>(sample.deadEnds);
+        result.unreachableRooms += static_cast<double>(sample.unreachableRooms);
+        result.doors += static_cast<double>(sample.doors);
+        result.enemies += static_cast<double>(sample.enemies);
+    }
+
+    // Nearest-rank percentiles
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&](double p) {
+        const size_t rank = static_cast<size_t>(p * static_cast<double>(latencies.size()) + 0.999999);
+        return latencies[std::min(latencies.size(), std::max<size_t>(rank, 1)) - 1] / 1e6;
+    };
+    result.p50Ms = percentile(0.50);
+    result.p90Ms = percentile(0.90);
+    result.p99Ms = percentile(0.99);
+    result.maxMs = latencies.back() / 1e6;
+
+    const double floors = static_cast<double>(samples.size());
+    const double seconds = totals.wallNs / 1e9;
+    result.floorsPerSec = floors / seconds;
+    result.roomsPerSec = static_cast<double>(rooms) / seconds;
+    result.tilesPerSec = static_cast<double>(tiles) / seconds;
+    result.allocsPerFloor = static_cast<double>(allocations) / floors;
+    result.bytesPerFloor = static_cast<double>(bytes) / floors;
+    result.stairsPath = reachable ? pathSum / static_cast<double>(reachable) : 0.0;
+    result.deadEnds /= floors;
+    result.unreachableRooms /= floors;
+    result.doors /= floors;
+    result.enemies /= floors;
+    result.peakRssKb = peakRssKb();
+    return result;
+}
+
+static void printHeader() {
+    std::printf("%-6s %-18s %6s %9s %9s %9s %9s %9s %11s %11s %10s | %8s %6s %8s %8s %7s\n",
+                "mode", "config", "floors", "p50 ms", "p90 ms", "p99 ms", "max ms", "floors/s",
+                "rooms/s", "Mtiles/s", "allocs/fl", "stairs", "unrch", "deadends", "cutrooms", "doors");
+}
+
+static void printResult(const GenResult& r) {
+    std::printf("%-6s %-18s %6zu %9.3f %9.3f %9.3f %9.3f %9.1f %11.0f %11.2f %10.0f | %8.1f %6zu %8.1f %8.2f %7.1f\n",
+                r.mode.c_str(), r.config.c_str(), r.floors, r.p50Ms, r.p90Ms, r.p99Ms, r.maxMs, r.floorsPerSec,
+                r.roomsPerSec, r.tilesPerSec / 1e6, r.allocsPerFloor, r.stairsPath, r.stairsUnreachable,
+                r.deadEnds, r.unreachableRooms, r.doors);
+    std::fflush(stdout);
+}
+
+// ---- Modes ----
+
+static void benchLayouts(const GenOptions& options, std::vector<GenResult>& results) {
+    for (const std::string& generator : options.generators) {
+        if (!DungeonGenerator::create(generator)) {
+            std::fprintf(stderr, "[Bench] Unknown generator '%s', skipped\n", generator.c_str());
+            continue;
+        }
+        for (const auto& [width, height] : options.sizes) {
+            const int rooms = options.rooms > 0 ? options.rooms : std::max(8, width * height / 1024);
+            std::vector<FloorSample> samples(options.seeds);
+            BatchTotals totals;
+            for (size_t first = 0; first < samples.size(); first += options.threads) {
+                const size_t count = std::min<size_t>(options.threads, samples.size() - first);
+                runBatch(samples, first, count, options.threads, totals,
+                         [&](size_t index, Dungeon& dungeon, EnemyManager&) {
+                             dungeon.generate(RandomStream(options.firstSeed + index), rooms, width, height, generator);
+                         },
+                         [](size_t, const Dungeon&, const EnemyManager&) {});
+            }
+            const std::string config = generator + " " + std::to_string(width) + "x" + std::to_string(height);
+            results.push_back(summarize("layout", config, samples, totals));
+            printResult(results.back());
+        }
+    }
+}
+
+// False if some floor could not be saved or had no valid snapshot to load
+static bool benchLevels(const GenOptions& options, std::vector<GenResult>& results) {
+    DungeonLevelManager levels;
+    levels.loadLevels(options.levelsPath);
+    const int floors = levels.getMaxFloors();
+
+    const bool loading = !options.loadFloorsDir.empty();
+    const bool saving = !options.saveFloorsDir.empty();
+    if (loading) levels.setFloorCacheDirectory(options.loadFloorsDir);
+    if (saving) levels.setFloorCacheDirectory(options.saveFloorsDir);
+    std::atomic<size_t> failures{0};
+
+    // samples[floor - 1][run]
+    std::vector<std::vector<FloorSample>> samples(floors, std::vector<FloorSample>(options.seeds));
+    std::vector<BatchTotals> totals(floors);
+    std::vector<FloorSample> batch(floors);
+    for (size_t run = 0; run < options.seeds; run++) {
+        // Floors read the run seed through Random::stream(), so one seed at a time
+        Random::getInstance().seed(options.firstSeed + run);
+        for (int first = 0; first < floors; first += static_cast<int>(options.threads)) {
+            const size_t count = std::min<size_t>(options.threads, static_cast<size_t>(floors - first));
+            BatchTotals batchTotals;
+            runBatch(batch, static_cast<size_t>(first), count, options.threads, batchTotals,
+                     [&](size_t index, Dungeon& dungeon, EnemyManager& enemies) {
+                         const int floor = static_cast<int>(index) + 1;
+                         if (loading) {
+                             std::vector<Loot> loots;
+                             if (!levels.restoreFloor(floor, dungeon, enemies, loots)) failures++;
+                         } else {
+                             levels.buildLevel(floor, dungeon, enemies);
+                         }
+                     },
+                     [&](size_t index, const Dungeon& dungeon, const EnemyManager& enemies) {
+                         if (saving && !levels.saveFloor(static_cast<int>(index) + 1, dungeon, enemies, {})) failures++;
+                     });
+            // The batch mixes floors, so each floor's rates use its own time
+            for (size_t i = 0; i < count; i++) {
+                const size_t floor = static_cast<size_t>(first) + i;
+                samples[floor][run] = batch[floor];
+                totals[floor].wallNs += batch[floor].ns;
+            }
+        }
+    }
+
+    for (int floor = 1; floor <= floors; floor++) {
+        const LevelData& data = levels.getLevelData(floor);
+        const std::string config = "floor " + std::to_string(floor) + " " + data.generator;
+        results.push_back(summarize(loading ? "load" : "level", config, samples[floor - 1], totals[floor - 1]));
+        printResult(results.back());
+    }
+
+    if (failures > 0) {
+        std::fprintf(stderr, "[Bench] %zu floors could not be %s %s\n", failures.load(),
+                     loading ? "restored from" : "saved to", loading ? options.loadFloorsDir.c_str() : options.saveFloorsDir.c_str());
+        return false;
+    }
+    return true;
+}
+
+// ---- Output ----
+
+static int writeResults(const GenOptions& options, const std::vector<GenResult>& results) {
+    if (!options.jsonPath.empty()) {
+        std::ofstream out(options.jsonPath);
+        if (!out) {
+            std::cerr << "[Bench] Cannot write " << options.jsonPath << std::endl;
+            return 1;
+        }
+        // One result per line so baselines diff cleanly
+        out << "{\"results\": [\n";
+        for (size_t i = 0; i < results.size(); i++) {
+            const GenResult& r = results[i];
+            nlohmann::ordered_json row = {
+                {"mode", r.mode}, {"config", r.config}, {"floors", r.floors},
+                {"p50_ms", r.p50Ms}, {"p90_ms", r.p90Ms}, {"p99_ms", r.p99Ms}, {"max_ms", r.maxMs},
+                {"floors_per_sec", r.floorsPerSec}, {"rooms_per_sec", r.roomsPerSec},
+                {"tiles_per_sec", r.tilesPerSec}, {"allocs_per_floor", r.allocsPerFloor},
+                {"bytes_per_floor", r.bytesPerFloor}, {"stairs_path", r.stairsPath},
+                {"stairs_unreachable", r.stairsUnreachable}, {"dead_ends", r.deadEnds},
+                {"unreachable_rooms", r.unreachableRooms}, {"doors", r.doors},
+                {"enemies", r.enemies}, {"peak_rss_kb", r.peakRssKb},
+            };
+            out << "  " << row.dump() << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+        out << "]}\n";
+    }
+
+    if (!options.comparePath.empty()) {
+        std::ifstream in(options.comparePath);
+        nlohmann::json baseline = nlohmann::json::parse(in, nullptr, false);
+        if (baseline.is_discarded() || !baseline.contains("results")) {
+            std::cerr << "[Bench] Cannot read baseline " << options.comparePath << std::endl;
+            return 1;
+        }
+
+        std::map<std::pair<std::string, std::string>, nlohmann::json> rows;
+        for (const auto& row : baseline["results"]) {
+            rows[{row["mode"], row["config"]}] = row;
+        }
+
+        std::printf("\nCompared with %s (time ratio > 1 is slower; quality columns show the change):\n",
+                    options.comparePath.c_str());
+        std::printf("  %-6s %-18s %8s %8s %9s %9s %9s\n", "mode", "config", "p50", "p99", "stairs", "deadends", "cutrooms");
+        for (const GenResult& r : results) {
+            auto it = rows.find({r.mode, r.config});
+            if (it == rows.end()) continue;
+            const nlohmann::json& old = it->second;
+            const double p50 = old["p50_ms"].get<double>();
+            const double p99 = old["p99_ms"].get<double>();
+            std::printf("  %-6s %-18s %7.2fx %7.2fx %+9.1f %+9.1f %+9.2f\n", r.mode.c_str(), r.config.c_str(),
+                        p50 > 0.0 ? r.p50Ms / p50 : 0.0, p99 > 0.0 ? r.p99Ms / p99 : 0.0,
+                        r.stairsPath - old["stairs_path"].get<double>(),
+                        r.deadEnds - old["dead_ends"].get<double>(),
+                        r.unreachableRooms - old["unreachable_rooms"].get<double>());
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    const GenOptions options = parseOptions(argc, argv);
+
+    // The generators log every room and door; a silenced stream drops that output cheaply
+    // and is safe to "write" from every worker at once
+    if (!options.verbose) {
+        std::cout.setstate(std::ios::badbit);
+        std::cerr.setstate(std::ios::badbit);
+    }
+
+    std::printf("%zu floors per configuration on %u threads\n", options.seeds, options.threads);
+    printHeader();
+
+    std::vector<GenResult> results;
+    if (options.mode != "level") benchLayouts(options, results);
+    const bool levelsOk = options.mode == "layout" || benchLevels(options, results);
+
+    std::cout.clear();
+    std::cerr.clear();
+    const int status = writeResults(options, results);
+    return status != 0 ? status : (levelsOk ? 0 : 1);
+}
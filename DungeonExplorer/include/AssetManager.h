@@ -1,8 +1,9 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include <string>
-#include <unordered_map>
+#include <string_view>
 #include <memory>
+#include "DataStructures/HashTable.h"
 
 enum class AssetPack {
     TinyDungeon,   // Default colorful pack
@@ -18,10 +19,10 @@ public:
     bool loadFromManifest(const std::string& jsonPath);
     
     // Get texture by key
-    sf::Texture* getTexture(const std::string& key);
+    sf::Texture* getTexture(std::string_view key);
     
     // Check if texture exists
-    bool hasTexture(const std::string& key) const;
+    bool hasTexture(std::string_view key) const;
     
     // Load individual texture
     bool loadTexture(const std::string& key, const std::string& filePath);
@@ -35,12 +36,12 @@ public:
     void clear();
     
     // Get spritesheet for animations
-    sf::Texture* getSpritesheet(const std::string& sheetName);
+    sf::Texture* getSpritesheet(std::string_view sheetName);
     // Create an sf::Sprite from a spritesheet by tile index
     // tileIndex: sequential tile number (0-based)
     // columns, tileSize, spacing are used to compute the texture rect
     // Returns true if sprite was created and assigned to outSprite. Returns false if sheet not found.
-    bool createSpriteFromSheet(const std::string& sheetName, int tileIndex, sf::Sprite& outSprite, int columns = 12, int tileSize = 16, int spacing = 1);
+    bool createSpriteFromSheet(std::string_view sheetName, int tileIndex, sf::Sprite& outSprite, int columns = 12, int tileSize = 16, int spacing = 1);
     
 private:
     AssetManager() = default;
@@ -54,6 +55,7 @@ private:
     void loadOneBitPack();
     
     AssetPack currentPack = AssetPack::TinyDungeon;
-    std::unordered_map<std::string, std::unique_ptr<sf::Texture>> textures;
-    std::unordered_map<std::string, std::unique_ptr<sf::Texture>> spritesheets;
+    // CHANGE: 2026-10-16 - Open-addressing tables; per-frame lookups by string_view never allocate
+    HashTable<std::string, std::unique_ptr<sf::Texture>, NoTrace> textures;
+    HashTable<std::string, std::unique_ptr<sf::Texture>, NoTrace> spritesheets;
 };
@@ -0,0 +1,27 @@
+// CHANGE: 2026-10-17 - Bit scans over 64-bit walk words, shared by the tile-map code
+// (caves, connectivity runs, jump point search). C++17 has no std::countr_zero, so these
+// use the GCC/Clang builtins and fall back to a loop elsewhere.
+
+#pragma once
+#include <cstdint>
+
+// Index of the lowest / highest set bit (word must be non-zero)
+inline int lowestBit(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    int bit = 0;
+    while (!(word & 1)) { word >>= 1; bit++; }
+    return bit;
+#endif
+}
+
+inline int highestBit(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(word);
+#else
+    int bit = 63;
+    while (!(word >> 63)) { word <<= 1; bit--; }
+    return bit;
+#endif
+}
@@ -0,0 +1,180 @@
+// CHANGE: 2026-10-16 - Sparse tile storage for runtime-sized floors (256x256 .. 4096x4096)
+// The map is a directory of 64x64 chunks. A chunk is allocated the first time a tile
+// in it is set to something other than the fill value (solid rock), so memory follows
+// the carved area instead of the bounding box.
+//
+// Each chunk holds:
+//   tiles[64*64]  one byte per tile (the caller's tile enum), row-major
+//   walk[64]      one 64-bit word per chunk row, bit x = tile x is walkable
+// Chunks are aligned to multiples of 64 in x, so walkWord(x, y) is a single
+// load that covers 64 horizontally adjacent tiles.
+//
+// Every access is O(1): one directory lookup and one in-chunk index.
+
+#pragma once
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+
+class ChunkedTileMap {
+public:
+    static constexpr int CHUNK_SHIFT = 6;
+    static constexpr int CHUNK_SIZE = 1 << CHUNK_SHIFT;  // 64
+    static constexpr int CHUNK_MASK = CHUNK_SIZE - 1;
+    static constexpr int CHUNK_TILES = CHUNK_SIZE * CHUNK_SIZE;
+
+    struct Chunk {
+        uint8_t tiles[CHUNK_TILES];
+        uint64_t walk[CHUNK_SIZE];
+    };
+
+    ChunkedTileMap() = default;
+
+    ChunkedTileMap(int width, int height, uint8_t fill) {
+        reset(width, height, fill);
+    }
+
+    // Drop every chunk and resize. Unallocated space reads as 'fill', not walkable.
+    void reset(int width, int height, uint8_t fill) {
+        mapWidth = width > 0 ? width : 0;
+        mapHeight = height > 0 ? height : 0;
+        fillTile = fill;
+        chunksX = (mapWidth + CHUNK_MASK) >> CHUNK_SHIFT;
+        chunksY = (mapHeight + CHUNK_MASK) >> CHUNK_SHIFT;
+        chunks.clear();
+        chunks.resize(static_cast<size_t>(chunksX) * chunksY);
+        allocated = 0;
+    }
+
+    int width() const { return mapWidth; }
+    int height() const { return mapHeight; }
+    int chunkCountX() const { return chunksX; }
+    int chunkCountY() const { return chunksY; }
+    uint8_t fill() const { return fillTile; }
+
+    bool inBounds(int x, int y) const {
+        return static_cast<unsigned>(x) < static_cast<unsigned>(mapWidth) &&
+               static_cast<unsigned>(y) < static_cast<unsigned>(mapHeight);
+    }
+
+    // ---- Tiles (callers bounds-check first) ----
+
+    uint8_t get(int x, int y) const {
+        const Chunk* chunk = chunkFor(x, y);
+        return chunk ? chunk->tiles[localIndex(x, y)] : fillTile;
+    }
+
+    void set(int x, int y, uint8_t tile) {
+        Chunk* chunk = chunkFor(x, y);
+        if (!chunk) {
+            if (tile == fillTile) return;  // Still solid: stay unallocated
+            chunk = allocate(x >> CHUNK_SHIFT, y >> CHUNK_SHIFT);
+        }
+        chunk->tiles[localIndex(x, y)] = tile;
+    }
+
+    // Tiles [x0, x1) of row y set to 'tile', one memset per chunk touched
+    void fillRun(int x0, int x1, int y, uint8_t tile) {
+        while (x0 < x1) {
+            const int end = std::min(x1, (x0 | CHUNK_MASK) + 1);
+            Chunk* chunk = chunkFor(x0, y);
+            if (!chunk && tile != fillTile) {
+                chunk = allocate(x0 >> CHUNK_SHIFT, y >> CHUNK_SHIFT);
+            }
+            if (chunk) {
+                std::memset(&chunk->tiles[localIndex(x0, y)], tile, static_cast<size_t>(end - x0));
+            }
+            x0 = end;
+        }
+    }
+
+    // ---- Walkability bits ----
+
+    bool walkable(int x, int y) const {
+        const Chunk* chunk = chunkFor(x, y);
+        return chunk && ((chunk->walk[y & CHUNK_MASK] >> (x & CHUNK_MASK)) & 1);
+    }
+
+    void setWalkable(int x, int y, bool value) {
+        Chunk* chunk = chunkFor(x, y);
+        if (!chunk) {
+            if (!value) return;
+            chunk = allocate(x >> CHUNK_SHIFT, y >> CHUNK_SHIFT);
+        }
+        const uint64_t bit = uint64_t(1) << (x & CHUNK_MASK);
+        if (value) {
+            chunk->walk[y & CHUNK_MASK] |= bit;
+        } else {
+            chunk->walk[y & CHUNK_MASK] &= ~bit;
+        }
+    }
+
+    // Walk bits for tiles [x & ~63, (x & ~63) + 64) of row y; 0 where unallocated
+    uint64_t walkWord(int x, int y) const {
+        const Chunk* chunk = chunkFor(x, y);
+        return chunk ? chunk->walk[y & CHUNK_MASK] : 0;
+    }
+
+    // ---- Chunk access ----
+
+    const Chunk* chunkAt(int chunkX, int chunkY) const {
+        return chunks[static_cast<size_t>(chunkY) * chunksX + chunkX].get();
+    }
+
+    // f(chunkX, chunkY, const Chunk&) for every allocated chunk, row by row
+    template<typename F>
+    void forEachChunk(F&& f) const {
+        for (int cy = 0; cy < chunksY; cy++) {
+            for (int cx = 0; cx < chunksX; cx++) {
+                if (const Chunk* chunk = chunkAt(cx, cy)) f(cx, cy, *chunk);
+            }
+        }
+    }
+
+    // Overwrite a whole chunk, tiles and walk bits (e.g. from a floor snapshot)
+    void loadChunk(int chunkX, int chunkY, const Chunk& source) {
+        Chunk* chunk = chunks[static_cast<size_t>(chunkY) * chunksX + chunkX].get();
+        if (!chunk) chunk = allocate(chunkX, chunkY);
+        std::memcpy(chunk, &source, sizeof(Chunk));
+    }
+
+    size_t allocatedChunks() const { return allocated; }
+
+    size_t memoryBytes() const {
+        return sizeof(*this) + chunks.capacity() * sizeof(std::unique_ptr<Chunk>) + allocated * sizeof(Chunk);
+    }
+
+private:
+    int mapWidth = 0;
+    int mapHeight = 0;
+    int chunksX = 0;
+    int chunksY = 0;
+    uint8_t fillTile = 0;
+    size_t allocated = 0;
+    std::vector<std::unique_ptr<Chunk>> chunks;  // chunksX * chunksY, nullptr = solid fill
+
+    static int localIndex(int x, int y) {
+        return ((y & CHUNK_MASK) << CHUNK_SHIFT) | (x & CHUNK_MASK);
+    }
+
+    const Chunk* chunkFor(int x, int y) const {
+        return chunks[static_cast<size_t>(y >> CHUNK_SHIFT) * chunksX + (x >> CHUNK_SHIFT)].get();
+    }
+
+    Chunk* chunkFor(int x, int y) {
+        return chunks[static_cast<size_t>(y >> CHUNK_SHIFT) * chunksX + (x >> CHUNK_SHIFT)].get();
+    }
+
+    Chunk* allocate(int chunkX, int chunkY) {
+        auto chunk = std::make_unique<Chunk>();
+        std::memset(chunk->tiles, fillTile, sizeof(chunk->tiles));
+        std::memset(chunk->walk, 0, sizeof(chunk->walk));
+        Chunk* raw = chunk.get();
+        chunks[static_cast<size_t>(chunkY) * chunksX + chunkX] = std::move(chunk);
+        allocated++;
+        return raw;
+    }
+};
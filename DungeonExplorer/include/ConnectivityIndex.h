@@ -0,0 +1,63 @@
+// CHANGE: 2026-10-16 - Connected regions of walkable tiles, for O(1)-ish reachability
+// Built from the ChunkedTileMap walk bits, 64 tiles per word:
+// - Each row is cut into runs of walkable tiles; runs that share a column with a run in
+//   the row above are joined in a DisjointSet (4-connectivity, the same moves enemies and
+//   the player make). Two tiles are reachable from each other iff their runs share a root.
+// - tileChanged() keeps the index current when one walk bit flips: a tile that opens
+//   becomes a run (or extends one) and is joined to its neighbours. A tile that closes is
+//   cut out of its run; if its open neighbours still touch around it nothing can have
+//   split, otherwise the index is marked stale and relabelled on the next query.
+// Queries cost one binary search over the runs of a row plus a find().
+
+#pragma once
+#include <vector>
+#include <cstddef>
+#include "DataStructures/DisjointSet.h"
+
+class ChunkedTileMap;
+
+class ConnectivityIndex {
+public:
+    ConnectivityIndex();
+
+    // Relabel every walkable tile of the map
+    void rebuild(const ChunkedTileMap& map);
+
+    // The walk bit of (x, y) may have changed since the last rebuild/update
+    void tileChanged(const ChunkedTileMap& map, int x, int y);
+
+    // A closed tile may have split a region; connected()/regionOf() need a rebuild() first
+    bool needsRebuild() const { return stale; }
+
+    // Region id of a walkable tile (stable until the next change), -1 when blocked
+    int regionOf(int x, int y) const;
+    bool connected(int ax, int ay, int bx, int by) const {
+        const int a = regionOf(ax, ay);
+        return a >= 0 && a == regionOf(bx, by);
+    }
+
+    size_t getRebuildCount() const { return rebuilds; }
+    size_t getIncrementalUpdates() const { return updates; }
+
+private:
+    struct Run {
+        int x0, x1;  // Walkable tiles [x0, x1) of one row
+        int node;    // DisjointSet element
+    };
+
+    int width;
+    int height;
+    std::vector<std::vector<Run>> rows;  // Sorted by x0, never touching
+    mutable DisjointSet<NoTrace> regions;
+    bool stale;
+    size_t rebuilds;
+    size_t updates;
+
+    // Index into rows[y] of the run holding x, or -1
+    int runAt(int x, int y) const;
+    void joinAt(int node, int x, int y);  // Join node with the run of row y holding x, if any
+    void open(int x, int y);
+    void close(const ChunkedTileMap& map, int x, int y);
+    // True if the open tiles around a just-closed (x, y) still touch each other
+    bool neighboursStayJoined(const ChunkedTileMap& map, int x, int y) const;
+};
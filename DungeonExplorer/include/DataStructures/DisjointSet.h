@@ -0,0 +1,79 @@
+#pragma once
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include "TracePolicy.h"
+
+// CHANGE: 2026-10-16 - Union-find over the integers [0, n)
+// Union by size plus path halving: any sequence of m operations runs in
+// O(m * alpha(n)), effectively constant per call. Used by Kruskal's MST when
+// connecting dungeon rooms, cave region labelling and the tile connectivity index.
+template<typename Trace = DefaultTrace>
+class DisjointSet : private Trace {
+private:
+    std::vector<int> parent;
+    std::vector<int> setSize;  // Valid for roots only
+    size_t sets = 0;
+
+public:
+    DisjointSet() = default;
+
+    explicit DisjointSet(size_t n) {
+        reset(n);
+    }
+
+    // n singleton sets; keeps the buffers' capacity
+    void reset(size_t n) {
+        parent.resize(n);
+        setSize.assign(n, 1);
+        for (size_t i = 0; i < n; i++) {
+            parent[i] = static_cast<int>(i);
+        }
+        sets = n;
+    }
+
+    // Append one singleton set and return its element
+    int add() {
+        const int x = static_cast<int>(parent.size());
+        parent.push_back(x);
+        setSize.push_back(1);
+        sets++;
+        return x;
+    }
+
+    int find(int x) {
+        this->traceLookup();
+        while (parent[x] != x) {
+            this->traceProbe();
+            parent[x] = parent[parent[x]];
+            x = parent[x];
+        }
+        return x;
+    }
+
+    // Merge the sets holding a and b; false if they were already one set
+    bool unite(int a, int b) {
+        a = find(a);
+        b = find(b);
+        if (a == b) return false;
+
+        if (setSize[a] < setSize[b]) std::swap(a, b);
+        parent[b] = a;
+        setSize[a] += setSize[b];
+        sets--;
+        this->traceInsert(static_cast<size_t>(setSize[a]));
+        this->traceLog([&](std::ostream& os) { os << "[DSA-DisjointSet] Joined " << b << " into " << a; });
+        return true;
+    }
+
+    bool connected(int a, int b) {
+        return find(a) == find(b);
+    }
+
+    size_t size() const { return parent.size(); }
+    size_t setCount() const { return sets; }
+
+    // Operation counters from the tracing policy (all zero under NoTrace)
+    using Trace::traceStats;
+    using Trace::resetTraceStats;
+};
@@ -8,145 +8,510 @@
 #include <limits>
 #include <algorithm>
 #include <functional>
+#include <cstddef>
+#include <cstdint>
+#include "TracePolicy.h"
+#include "Heap.h"
+#include "RadixHeap.h"
+
+// CHANGE: 2026-10-16 - Frozen CSR (compressed sparse row) adjacency mode
+// - Vertices get dense indices in insertion order
+// - freeze() packs edges into contiguous offset/target/weight arrays
+// - neighbors() returns a non-owning range, so traversals never allocate per expansion
+// - Any mutation thaws the graph; traversals re-freeze on demand
+// CHANGE: 2026-10-16 - Real shortest-path queries
+// - ShortestPathTree keeps distances and predecessors so paths can be rebuilt
+// - shortestPath() stops as soon as the target is settled; aStar() takes a heuristic
+// - getVersion() lets callers cache derived data until the graph changes
+// CHANGE: 2026-10-16 - Selectable priority queue for Dijkstra/A*
+// - Indexed 4-ary heap with decrease-key (default), lazy binary heap with
+//   duplicate entries (the old behaviour), or a monotone radix heap for
+//   small non-negative integer weights
+template<typename T, typename Trace = DefaultTrace>
+class Graph : private Trace {
+public:
+    struct Edge {
+        int target;  // Dense index of the neighbor
+        int weight;
+    };
+
+    // Non-owning view over one vertex's edges in the CSR arrays
+    class NeighborRange {
+    public:
+        class iterator {
+        public:
+            iterator(const int* t, const int* w) : target(t), weight(w) {}
+            Edge operator*() const { return Edge{*target, *weight}; }
+            iterator& operator++() { ++target; ++weight; return *this; }
+            bool operator==(const iterator& other) const { return target == other.target; }
+            bool operator!=(const iterator& other) const { return target != other.target; }
+        private:
+            const int* target;
+            const int* weight;
+        };
+
+        NeighborRange(const int* t, const int* w, size_t n) : targets(t), weights(w), count(n) {}
+
+        iterator begin() const { return iterator(targets, weights); }
+        iterator end() const { return iterator(targets + count, weights + count); }
+        size_t size() const { return count; }
+        bool empty() const { return count == 0; }
+
+    private:
+        const int* targets;
+        const int* weights;
+        size_t count;
+    };
+
+    // Priority queue used by dijkstra(), shortestPathTree(), shortestPath() and aStar()
+    enum class QueueKind {
+        LazyBinary,  // std::push_heap with duplicate entries instead of decrease-key
+        Indexed,     // Indexed 4-ary Heap with decreaseKey
+        Radix        // Monotone RadixHeap; weights must be non-negative integers
+    };
+
+    // Single-source search result, indexed by dense vertex index
+    struct ShortestPathTree {
+        int source = -1;
+        std::vector<int> distance;     // INT_MAX when unreachable
+        std::vector<int> predecessor;  // -1 for the source and unreachable vertices
+
+        bool reaches(int index) const {
+            return index >= 0 && index < static_cast<int>(distance.size()) &&
+                   distance[index] != std::numeric_limits<int>::max();
+        }
+    };
 
-template<typename T>
-class Graph {
 private:
-    std::unordered_map<T, std::vector<std::pair<T, int>>> adjacencyList; // node -> [(neighbor, weight)]
-    
+    static constexpr int UNREACHABLE = std::numeric_limits<int>::max();
+
+    // Mutable builder representation: dense index -> [(neighbor index, weight)]
+    std::vector<std::vector<std::pair<int, int>>> adjacency;
+    std::vector<T> vertices;                  // dense index -> vertex
+    std::unordered_map<T, int> vertexIndex;   // vertex -> dense index
+
+    // Frozen CSR representation (valid while frozen == true)
+    bool frozen = false;
+    unsigned int version = 0;  // Bumped on every structural change
+    std::vector<int> offsets;  // size vertexCount + 1
+    std::vector<int> targets;
+    std::vector<int> weights;
+
+    // Scratch buffers reused across traversals
+    std::vector<unsigned char> visitedScratch;
+    std::vector<int> frontierScratch;
+    std::vector<int> distanceScratch;
+    std::vector<int> predecessorScratch;
+    std::vector<std::pair<int, int>> heapScratch;  // (distance, vertex index) min-heap
+
+    struct FrontierEntry {
+        int key;
+        int vertex;
+    };
+    struct FrontierGreater {
+        bool operator()(const FrontierEntry& a, const FrontierEntry& b) const { return a.key > b.key; }
+    };
+    using IndexedQueue = Heap<FrontierEntry, FrontierGreater, 4, NoTrace>;
+
+    QueueKind queueKind = QueueKind::Indexed;
+    IndexedQueue indexedScratch;
+    std::vector<typename IndexedQueue::Handle> handleScratch;  // vertex index -> handle
+    RadixHeap<int, NoTrace> radixScratch;
+
+    // Frontier adapters: push(key, vertex) inserts or lowers a key, pop() returns the minimum vertex
+    struct LazyFrontier {
+        std::vector<std::pair<int, int>>& pq;
+
+        bool empty() const { return pq.empty(); }
+        void push(int key, int vertex) {
+            pq.push_back({key, vertex});
+            std::push_heap(pq.begin(), pq.end(), std::greater<std::pair<int, int>>());
+        }
+        int pop() {
+            std::pop_heap(pq.begin(), pq.end(), std::greater<std::pair<int, int>>());
+            int vertex = pq.back().second;
+            pq.pop_back();
+            return vertex;
+        }
+    };
+
+    struct IndexedFrontier {
+        IndexedQueue& heap;
+        std::vector<typename IndexedQueue::Handle>& handles;
+
+        bool empty() const { return heap.isEmpty(); }
+        void push(int key, int vertex) {
+            if (handles[vertex] != IndexedQueue::INVALID_HANDLE) {
+                heap.decreaseKey(handles[vertex], FrontierEntry{key, vertex});
+            } else {
+                handles[vertex] = heap.insert(FrontierEntry{key, vertex});
+            }
+        }
+        int pop() {
+            int vertex = heap.extractTop().vertex;
+            handles[vertex] = IndexedQueue::INVALID_HANDLE;
+            return vertex;
+        }
+    };
+
+    struct RadixFrontier {
+        RadixHeap<int, NoTrace>& heap;
+
+        bool empty() const { return heap.isEmpty(); }
+        void push(int key, int vertex) { heap.push(static_cast<uint32_t>(key), vertex); }
+        int pop() { return heap.pop().second; }
+    };
+
+    void thaw() {
+        frozen = false;
+        version++;
+    }
+
+    void ensureFrozen() {
+        if (!frozen) {
+            freeze();
+        }
+    }
+
+    // Dijkstra/A* core. Stops early once goal is settled (goal < 0 = settle everything).
+    // heuristic(index) must be consistent; a zero heuristic gives plain Dijkstra.
+    template<typename H>
+    void search(int source, int goal, H&& heuristic, std::vector<int>& dist, std::vector<int>& pred) {
+        ensureFrozen();
+        dist.assign(vertices.size(), UNREACHABLE);
+        pred.assign(vertices.size(), -1);
+        visitedScratch.assign(vertices.size(), 0);  // Settled flags
+        dist[source] = 0;
+
+        switch (queueKind) {
+            case QueueKind::LazyBinary:
+                heapScratch.clear();
+                runSearch(LazyFrontier{heapScratch}, source, goal, heuristic, dist, pred);
+                break;
+            case QueueKind::Indexed:
+                indexedScratch.clear();
+                handleScratch.assign(vertices.size(), IndexedQueue::INVALID_HANDLE);
+                runSearch(IndexedFrontier{indexedScratch, handleScratch}, source, goal, heuristic, dist, pred);
+                break;
+            case QueueKind::Radix:
+                radixScratch.clear();
+                runSearch(RadixFrontier{radixScratch}, source, goal, heuristic, dist, pred);
+                break;
+        }
+    }
+
+    template<typename Frontier, typename H>
+    void runSearch(Frontier frontier, int source, int goal, H& heuristic,
+                   std::vector<int>& dist, std::vector<int>& pred) {
+        frontier.push(heuristic(source), source);
+
+        while (!frontier.empty()) {
+            int current = frontier.pop();
+
+            // Lazy and radix frontiers may hold stale duplicates
+            if (visitedScratch[current]) continue;
+            visitedScratch[current] = 1;
+            if (current == goal) break;
+
+            this->traceProbe(neighbors(current).size());
+            for (Edge edge : neighbors(current)) {
+                int newDist = dist[current] + edge.weight;
+                if (newDist < dist[edge.target]) {
+                    dist[edge.target] = newDist;
+                    pred[edge.target] = current;
+                    frontier.push(newDist + heuristic(edge.target), edge.target);
+                }
+            }
+        }
+    }
+
+    std::vector<T> buildPath(int goal, const std::vector<int>& dist, const std::vector<int>& pred) const {
+        std::vector<T> path;
+        if (goal < 0 || dist[goal] == UNREACHABLE) return path;
+
+        for (int v = goal; v != -1; v = pred[v]) {
+            path.push_back(vertices[v]);
+        }
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+
 public:
     Graph() = default;
-    
+
     void addVertex(const T& vertex) {
-        if (adjacencyList.find(vertex) == adjacencyList.end()) {
-            adjacencyList[vertex] = std::vector<std::pair<T, int>>();
-            std::cout << "[DSA-Graph] Added vertex. Total vertices: " << adjacencyList.size() << std::endl;
+        if (vertexIndex.find(vertex) == vertexIndex.end()) {
+            vertexIndex[vertex] = static_cast<int>(vertices.size());
+            vertices.push_back(vertex);
+            adjacency.emplace_back();
+            thaw();
+            this->traceInsert(vertices.size());
+            this->traceLog([&](std::ostream& os) { os << "[DSA-Graph] Added vertex. Total vertices: " << vertices.size(); });
         }
     }
-    
+
     void addEdge(const T& from, const T& to, int weight = 1) {
         addVertex(from);
         addVertex(to);
-        adjacencyList[from].push_back({to, weight});
-        std::cout << "[DSA-Graph] Added edge from " << from << " to " << to << " (weight: " << weight << ")" << std::endl;
+        adjacency[vertexIndex[from]].push_back({vertexIndex[to], weight});
+        thaw();
+        this->traceInsert(vertices.size());
+        this->traceLog([&](std::ostream& os) { os << "[DSA-Graph] Added edge from " << from << " to " << to << " (weight: " << weight << ")"; });
     }
-    
+
     void addBidirectionalEdge(const T& v1, const T& v2, int weight = 1) {
         addEdge(v1, v2, weight);
         addEdge(v2, v1, weight);
     }
-    
-    std::vector<T> getNeighbors(const T& vertex) const {
-        std::vector<T> neighbors;
-        auto it = adjacencyList.find(vertex);
-        if (it != adjacencyList.end()) {
-            for (const auto& pair : it->second) {
-                neighbors.push_back(pair.first);
+
+    // Compact the adjacency lists into CSR arrays. Neighbor order is preserved.
+    void freeze() {
+        const size_t n = vertices.size();
+        offsets.assign(n + 1, 0);
+
+        size_t total = 0;
+        for (size_t i = 0; i < n; i++) {
+            offsets[i] = static_cast<int>(total);
+            total += adjacency[i].size();
+        }
+        offsets[n] = static_cast<int>(total);
+
+        targets.resize(total);
+        weights.resize(total);
+        size_t pos = 0;
+        for (size_t i = 0; i < n; i++) {
+            for (const auto& [neighbor, weight] : adjacency[i]) {
+                targets[pos] = neighbor;
+                weights[pos] = weight;
+                pos++;
             }
         }
-        return neighbors;
+
+        visitedScratch.reserve(n);
+        frontierScratch.reserve(n);
+        frozen = true;
     }
-    
+
+    bool isFrozen() const { return frozen; }
+
+    void setQueueKind(QueueKind kind) { queueKind = kind; }
+    QueueKind getQueueKind() const { return queueKind; }
+
+    // Dense index of a vertex, or -1 if it is not in the graph
+    int indexOf(const T& vertex) const {
+        this->traceLookup();
+        auto it = vertexIndex.find(vertex);
+        return it != vertexIndex.end() ? it->second : -1;
+    }
+
+    const T& vertexAt(int index) const { return vertices[index]; }
+
+    // Allocation-free neighbor range. Only valid on a frozen graph.
+    NeighborRange neighbors(int index) const {
+        const int begin = offsets[index];
+        const int end = offsets[index + 1];
+        return NeighborRange(targets.data() + begin, weights.data() + begin, static_cast<size_t>(end - begin));
+    }
+
+    // Visit (neighbor, weight) pairs without allocating, frozen or not
+    template<typename F>
+    void forEachNeighbor(const T& vertex, F&& func) const {
+        int index = indexOf(vertex);
+        if (index < 0) return;
+
+        if (frozen) {
+            for (Edge edge : neighbors(index)) {
+                func(vertices[edge.target], edge.weight);
+            }
+        } else {
+            for (const auto& [neighbor, weight] : adjacency[index]) {
+                func(vertices[neighbor], weight);
+            }
+        }
+    }
+
+    // Kept for callers that want an owning copy; prefer neighbors()/forEachNeighbor()
+    std::vector<T> getNeighbors(const T& vertex) const {
+        std::vector<T> result;
+        forEachNeighbor(vertex, [&](const T& neighbor, int) {
+            result.push_back(neighbor);
+        });
+        return result;
+    }
+
     std::vector<T> bfs(const T& start) {
-        std::cout << "[DSA-Graph] Running BFS from " << start << std::endl;
+        this->traceLog([&](std::ostream& os) { os << "[DSA-Graph] Running BFS from " << start; });
+        this->traceTraversal();
         std::vector<T> result;
-        std::unordered_set<T> visited;
-        std::queue<T> q;
-        
-        q.push(start);
-        visited.insert(start);
-        
-        while (!q.empty()) {
-            T current = q.front();
-            q.pop();
-            result.push_back(current);
-            
-            for (const auto& neighbor : getNeighbors(current)) {
-                if (visited.find(neighbor) == visited.end()) {
-                    visited.insert(neighbor);
-                    q.push(neighbor);
+        int startIndex = indexOf(start);
+        if (startIndex < 0) {
+            result.push_back(start);  // Unknown vertex: only the start itself is visited
+            return result;
+        }
+
+        ensureFrozen();
+        visitedScratch.assign(vertices.size(), 0);
+        frontierScratch.clear();
+
+        frontierScratch.push_back(startIndex);
+        visitedScratch[startIndex] = 1;
+
+        // frontierScratch doubles as the FIFO queue: [head, size) is pending
+        for (size_t head = 0; head < frontierScratch.size(); head++) {
+            int current = frontierScratch[head];
+            result.push_back(vertices[current]);
+
+            this->traceProbe(neighbors(current).size());
+            for (Edge edge : neighbors(current)) {
+                if (!visitedScratch[edge.target]) {
+                    visitedScratch[edge.target] = 1;
+                    frontierScratch.push_back(edge.target);
                 }
             }
         }
-        
-        std::cout << "[DSA-Graph] BFS visited " << result.size() << " nodes" << std::endl;
+
+        this->traceLog([&](std::ostream& os) { os << "[DSA-Graph] BFS visited " << result.size() << " nodes"; });
         return result;
     }
-    
+
     std::vector<T> dfs(const T& start) {
-        std::cout << "[DSA-Graph] Running DFS from " << start << std::endl;
+        this->traceLog([&](std::ostream& os) { os << "[DSA-Graph] Running DFS from " << start; });
+        this->traceTraversal();
         std::vector<T> result;
-        std::unordered_set<T> visited;
-        std::stack<T> s;
-        
-        s.push(start);
-        
-        while (!s.empty()) {
-            T current = s.top();
-            s.pop();
-            
-            if (visited.find(current) == visited.end()) {
-                visited.insert(current);
-                result.push_back(current);
-                
-                auto neighbors = getNeighbors(current);
-                for (auto it = neighbors.rbegin(); it != neighbors.rend(); ++it) {
-                    if (visited.find(*it) == visited.end()) {
-                        s.push(*it);
+        int startIndex = indexOf(start);
+        if (startIndex < 0) {
+            result.push_back(start);  // Unknown vertex: only the start itself is visited
+            return result;
+        }
+
+        ensureFrozen();
+        visitedScratch.assign(vertices.size(), 0);
+        frontierScratch.clear();
+
+        frontierScratch.push_back(startIndex);
+
+        while (!frontierScratch.empty()) {
+            int current = frontierScratch.back();
+            frontierScratch.pop_back();
+
+            if (!visitedScratch[current]) {
+                visitedScratch[current] = 1;
+                result.push_back(vertices[current]);
+
+                // Push in reverse so the first neighbor is explored first
+                this->traceProbe(neighbors(current).size());
+                for (int e = offsets[current + 1] - 1; e >= offsets[current]; e--) {
+                    int neighbor = targets[e];
+                    if (!visitedScratch[neighbor]) {
+                        frontierScratch.push_back(neighbor);
                     }
                 }
             }
         }
-        
-        std::cout << "[DSA-Graph] DFS visited " << result.size() << " nodes" << std::endl;
+
+        this->traceLog([&](std::ostream& os) { os << "[DSA-Graph] DFS visited " << result.size() << " nodes"; });
         return result;
     }
-    
+
     std::unordered_map<T, int> dijkstra(const T& start) {
-        std::cout << "[DSA-Graph] Running Dijkstra from " << start << std::endl;
+        this->traceLog([&](std::ostream& os) { os << "[DSA-Graph] Running Dijkstra from " << start; });
+        this->traceTraversal();
         std::unordered_map<T, int> distances;
-        
-        for (const auto& pair : adjacencyList) {
-            distances[pair.first] = std::numeric_limits<int>::max();
-        }
-        distances[start] = 0;
-        
-        using PQElement = std::pair<int, T>; // (distance, vertex)
-        std::priority_queue<PQElement, std::vector<PQElement>, std::greater<PQElement>> pq;
-        pq.push({0, start});
-        
-        while (!pq.empty()) {
-            auto [dist, current] = pq.top();
-            pq.pop();
-            
-            if (dist > distances[current]) continue;
-            
-            auto it = adjacencyList.find(current);
-            if (it != adjacencyList.end()) {
-                for (const auto& [neighbor, weight] : it->second) {
-                    int newDist = dist + weight;
-                    if (newDist < distances[neighbor]) {
-                        distances[neighbor] = newDist;
-                        pq.push({newDist, neighbor});
-                    }
-                }
-            }
+
+        for (const auto& vertex : vertices) {
+            distances[vertex] = std::numeric_limits<int>::max();
+        }
+
+        int startIndex = indexOf(start);
+        if (startIndex < 0) {
+            distances[start] = 0;
+            return distances;
         }
-        
-        std::cout << "[DSA-Graph] Dijkstra computed distances to " << distances.size() << " nodes" << std::endl;
+
+        search(startIndex, -1, [](int) { return 0; }, distanceScratch, predecessorScratch);
+
+        for (size_t i = 0; i < vertices.size(); i++) {
+            distances[vertices[i]] = distanceScratch[i];
+        }
+
+        this->traceLog([&](std::ostream& os) { os << "[DSA-Graph] Dijkstra computed distances to " << distances.size() << " nodes"; });
         return distances;
     }
-    
+
+    // Full Dijkstra that keeps the predecessor tree for path reconstruction
+    ShortestPathTree shortestPathTree(const T& start) {
+        this->traceLog([&](std::ostream& os) { os << "[DSA-Graph] Building shortest path tree from " << start; });
+        this->traceTraversal();
+        ShortestPathTree tree;
+        tree.source = indexOf(start);
+        if (tree.source < 0) return tree;
+
+        search(tree.source, -1, [](int) { return 0; }, tree.distance, tree.predecessor);
+        return tree;
+    }
+
+    // Path from the tree's source to target (inclusive), or empty if unreachable
+    std::vector<T> pathTo(const ShortestPathTree& tree, const T& target) const {
+        int targetIndex = indexOf(target);
+        if (!tree.reaches(targetIndex)) return {};
+        return buildPath(targetIndex, tree.distance, tree.predecessor);
+    }
+
+    // Single-target Dijkstra: stops as soon as 'to' is settled
+    std::vector<T> shortestPath(const T& from, const T& to) {
+        return aStar(from, to, [](const T&, const T&) { return 0; });
+    }
+
+    // A* with heuristic(vertex, goal) -> int. The heuristic must never overestimate
+    // and should be consistent, otherwise the returned path may not be shortest.
+    template<typename Heuristic>
+    std::vector<T> aStar(const T& from, const T& to, Heuristic&& heuristic) {
+        this->traceLog([&](std::ostream& os) { os << "[DSA-Graph] Searching path from " << from << " to " << to; });
+        this->traceTraversal();
+        int fromIndex = indexOf(from);
+        int toIndex = indexOf(to);
+        if (fromIndex < 0 || toIndex < 0) return {};
+
+        const T& goal = vertices[toIndex];
+        search(fromIndex, toIndex, [&](int index) { return heuristic(vertices[index], goal); },
+               distanceScratch, predecessorScratch);
+
+        std::vector<T> path = buildPath(toIndex, distanceScratch, predecessorScratch);
+        this->traceLog([&](std::ostream& os) { os << "[DSA-Graph] Path length: " << path.size() << " nodes"; });
+        return path;
+    }
+
     bool hasVertex(const T& vertex) const {
-        return adjacencyList.find(vertex) != adjacencyList.end();
+        this->traceLookup();
+        return vertexIndex.find(vertex) != vertexIndex.end();
     }
-    
+
     size_t vertexCount() const {
-        return adjacencyList.size();
+        return vertices.size();
     }
-    
+
+    // Changes whenever vertices or edges are added or the graph is cleared
+    unsigned int getVersion() const { return version; }
+
+    size_t edgeCount() const {
+        if (frozen) return targets.size();
+        size_t total = 0;
+        for (const auto& edges : adjacency) total += edges.size();
+        return total;
+    }
+
+    // Operation counters from the tracing policy (all zero under NoTrace)
+    using Trace::traceStats;
+    using Trace::resetTraceStats;
+
     void clear() {
-        adjacencyList.clear();
-        std::cout << "[DSA-Graph] Cleared graph" << std::endl;
+        adjacency.clear();
+        vertices.clear();
+        vertexIndex.clear();
+        offsets.clear();
+        targets.clear();
+        weights.clear();
+        thaw();
+        this->traceLog([&](std::ostream& os) { os << "[DSA-Graph] Cleared graph"; });
     }
 };
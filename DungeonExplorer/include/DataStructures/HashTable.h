@@ -1,63 +1,298 @@
 #pragma once
-#include <unordered_map>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <functional>
 #include <iostream>
 #include <optional>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+#include "TracePolicy.h"
 
-template<typename K, typename V>
-class HashTable {
+// CHANGE: 2026-10-16 - Open-addressing Robin Hood hash table
+// - Contiguous slot array plus one probe-distance byte per slot (0 = empty)
+// - Robin Hood insertion keeps probe sequences short; lookups stop as soon as
+//   they meet a slot that is "richer" than the key would be
+// - Backward-shift deletion, so there are no tombstones
+// - std::string keys are looked up through std::string_view (no temporary strings)
+// K and V must be default constructible and movable.
+
+// Key traits: how a key is hashed and which type lookups accept
+template<typename K>
+struct HashTableKey {
+    using Lookup = const K&;
+    static size_t hash(const K& key) { return std::hash<K>()(key); }
+};
+
+template<>
+struct HashTableKey<std::string> {
+    using Lookup = std::string_view;  // Accepts std::string, literals and views
+    static size_t hash(std::string_view key) { return std::hash<std::string_view>()(key); }
+};
+
+template<typename K, typename V, typename Trace = DefaultTrace>
+class HashTable : private Trace {
 private:
-    std::unordered_map<K, V> table;
+    using KeyTraits = HashTableKey<K>;
+    using Lookup = typename KeyTraits::Lookup;
+
+    struct Slot {
+        K key;
+        V value;
+    };
+
+    static constexpr size_t NOT_FOUND = static_cast<size_t>(-1);
+    static constexpr size_t MIN_CAPACITY = 8;
+    static constexpr uint8_t MAX_DISTANCE = 255;
+
+    std::vector<Slot> slots;
+    std::vector<uint8_t> distances;  // Probe distance + 1; 0 marks an empty slot
+    size_t count = 0;
+    size_t mask = 0;
+    unsigned shift = 64;
+
+    // Fibonacci hashing spreads weak hashes (std::hash<int> is the identity)
+    size_t homeSlot(size_t hash) const {
+        return static_cast<size_t>((static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >> shift) & mask;
+    }
+
+    // Max load factor 7/8
+    static bool overLoaded(size_t n, size_t capacity) {
+        return n * 8 > capacity * 7;
+    }
+
+    size_t findIndex(Lookup key) const {
+        if (count == 0) return NOT_FOUND;
+
+        size_t index = homeSlot(KeyTraits::hash(key));
+        // unsigned, not uint8_t: past MAX_DISTANCE every slot compares "richer" and ends the probe
+        for (unsigned dist = 1; ; dist++) {
+            this->traceProbe();
+            // Empty slot, or a resident closer to home than we would be: key is absent
+            if (distances[index] < dist) return NOT_FOUND;
+            if (distances[index] == dist) {
+                this->traceCompare();
+                if (slots[index].key == key) return index;
+            }
+            index = (index + 1) & mask;
+        }
+    }
+
+    // Insert a key known to be absent. 'landed' is the slot the entry passed in ended up in,
+    // or NOT_FOUND if it is still in 'entry'. Returns false if a probe run got too long
+    // ('entry' then holds whichever entry is still homeless).
+    bool insertNew(Slot& entry, size_t& landed) {
+        size_t index = homeSlot(KeyTraits::hash(entry.key));
+        uint8_t dist = 1;
+        landed = NOT_FOUND;
+
+        while (true) {
+            this->traceProbe();
+            if (distances[index] == 0) {
+                slots[index] = std::move(entry);
+                distances[index] = dist;
+                count++;
+                if (landed == NOT_FOUND) landed = index;
+                return true;
+            }
+            // Robin Hood: take the slot from a resident that is closer to its home. Later
+            // swaps only happen further along the run, so the first one is final.
+            if (distances[index] < dist) {
+                std::swap(entry, slots[index]);
+                std::swap(dist, distances[index]);
+                if (landed == NOT_FOUND) landed = index;
+            }
+            index = (index + 1) & mask;
+            if (dist == MAX_DISTANCE) return false;
+            dist++;
+        }
+    }
+
+    // Returns the slot the entry ended up in
+    size_t insertOrGrow(Slot&& entry) {
+        if (slots.empty() || overLoaded(count + 1, slots.size())) {
+            rehash(slots.empty() ? MIN_CAPACITY : slots.size() * 2);
+        }
+        size_t landed;
+        if (insertNew(entry, landed)) return landed;
+
+        // A probe run got too long: grow until the homeless resident fits. The rehash moves
+        // the new key too, so if it was already placed it is looked up again afterwards
+        // (the only path that copies a key).
+        std::optional<K> placedKey;
+        do {
+            if (landed != NOT_FOUND && !placedKey) placedKey.emplace(slots[landed].key);
+            rehash(slots.size() * 2);
+        } while (!insertNew(entry, landed));
+        return placedKey ? findIndex(*placedKey) : landed;
+    }
+
+    template<typename KK, typename VV>
+    V& assign(KK&& key, VV&& value) {
+        size_t index = findIndex(key);
+        if (index == NOT_FOUND) {
+            index = insertOrGrow(Slot{K(std::forward<KK>(key)), V(std::forward<VV>(value))});
+            this->traceInsert(count);
+        } else {
+            slots[index].value = std::forward<VV>(value);
+        }
+        return slots[index].value;
+    }
 
 public:
+    template<typename SlotT, typename Ref>
+    class Iterator {
+    public:
+        Iterator(SlotT* s, const uint8_t* d, size_t i, size_t n) : slots(s), dist(d), index(i), size(n) { skip(); }
+
+        std::pair<const K&, Ref> operator*() const { return {slots[index].key, slots[index].value}; }
+        Iterator& operator++() { index++; skip(); return *this; }
+        bool operator==(const Iterator& other) const { return index == other.index; }
+        bool operator!=(const Iterator& other) const { return index != other.index; }
+
+    private:
+        void skip() { while (index < size && dist[index] == 0) index++; }
+
+        SlotT* slots;
+        const uint8_t* dist;
+        size_t index;
+        size_t size;
+    };
+
+    using iterator = Iterator<Slot, V&>;
+    using const_iterator = Iterator<const Slot, const V&>;
+
     HashTable() = default;
-    
+
     void insert(const K& key, const V& value) {
-        table[key] = value;
-        std::cout << "[DSA-HashTable] Inserted key. Table size: " << table.size() << std::endl;
+        assign(key, value);
+        this->traceLog([&](std::ostream& os) { os << "[DSA-HashTable] Inserted key. Table size: " << count; });
     }
-    
-    std::optional<V> get(const K& key) const {
-        auto it = table.find(key);
-        if (it != table.end()) {
-            std::cout << "[DSA-HashTable] Key found" << std::endl;
-            return it->second;
+
+    void insert(K&& key, V&& value) {
+        assign(std::move(key), std::move(value));
+        this->traceLog([&](std::ostream& os) { os << "[DSA-HashTable] Inserted key. Table size: " << count; });
+    }
+
+    // Inserts a default value if the key is missing
+    V& operator[](Lookup key) {
+        this->traceLookup();
+        size_t index = findIndex(key);
+        if (index != NOT_FOUND) return slots[index].value;
+        return assign(K(key), V());
+    }
+
+    // Pointer to the value, or nullptr. Never copies the value.
+    V* find(Lookup key) {
+        this->traceLookup();
+        size_t index = findIndex(key);
+        return index != NOT_FOUND ? &slots[index].value : nullptr;
+    }
+
+    const V* find(Lookup key) const {
+        this->traceLookup();
+        size_t index = findIndex(key);
+        return index != NOT_FOUND ? &slots[index].value : nullptr;
+    }
+
+    std::optional<V> get(Lookup key) const {
+        if (const V* value = find(key)) {
+            this->traceLog([&](std::ostream& os) { os << "[DSA-HashTable] Key found"; });
+            return *value;
         }
-        std::cout << "[DSA-HashTable] Key not found" << std::endl;
+        this->traceLog([&](std::ostream& os) { os << "[DSA-HashTable] Key not found"; });
         return std::nullopt;
     }
-    
-    bool remove(const K& key) {
-        auto it = table.find(key);
-        if (it != table.end()) {
-            table.erase(it);
-            std::cout << "[DSA-HashTable] Removed key. Table size: " << table.size() << std::endl;
-            return true;
+
+    bool remove(Lookup key) {
+        size_t index = findIndex(key);
+        if (index == NOT_FOUND) return false;
+
+        // Backward shift: pull the following run one slot closer to home
+        size_t next = (index + 1) & mask;
+        while (distances[next] > 1) {
+            slots[index] = std::move(slots[next]);
+            distances[index] = distances[next] - 1;
+            index = next;
+            next = (next + 1) & mask;
         }
-        return false;
+        slots[index] = Slot();  // Release the moved-from key/value
+        distances[index] = 0;
+        count--;
+
+        this->traceRemove(count);
+        this->traceLog([&](std::ostream& os) { os << "[DSA-HashTable] Removed key. Table size: " << count; });
+        return true;
+    }
+
+    bool contains(Lookup key) const {
+        return find(key) != nullptr;
     }
-    
-    bool contains(const K& key) const {
-        return table.find(key) != table.end();
+
+    // Make room for n entries without rehashing
+    void reserve(size_t n) {
+        size_t needed = MIN_CAPACITY;
+        while (overLoaded(n, needed)) needed *= 2;
+        if (needed > slots.size()) rehash(needed);
     }
-    
+
+    // Rebuild with at least the given number of slots (rounded up to a power of two)
+    void rehash(size_t newCapacity) {
+        size_t capacity = MIN_CAPACITY;
+        while (capacity < newCapacity || overLoaded(count, capacity)) capacity *= 2;
+
+        std::vector<Slot> oldSlots(capacity);
+        std::vector<uint8_t> oldDistances(capacity, 0);
+        oldSlots.swap(slots);
+        oldDistances.swap(distances);
+
+        mask = capacity - 1;
+        shift = 64;
+        for (size_t c = capacity; c > 1; c >>= 1) shift--;
+        count = 0;
+
+        for (size_t i = 0; i < oldSlots.size(); i++) {
+            if (oldDistances[i] != 0) {
+                insertOrGrow(std::move(oldSlots[i]));
+            }
+        }
+    }
+
     size_t size() const {
-        return table.size();
+        return count;
     }
-    
-    bool isEmpty() const {
-        return table.empty();
+
+    size_t capacity() const {
+        return slots.size();
     }
-    
-    void clear() {
-        table.clear();
-        std::cout << "[DSA-HashTable] Cleared hash table" << std::endl;
+
+    float loadFactor() const {
+        return slots.empty() ? 0.f : static_cast<float>(count) / static_cast<float>(slots.size());
     }
-    
-    std::unordered_map<K, V>& getTable() {
-        return table;
+
+    bool isEmpty() const {
+        return count == 0;
     }
-    
-    const std::unordered_map<K, V>& getTable() const {
-        return table;
+
+    iterator begin() { return iterator(slots.data(), distances.data(), 0, slots.size()); }
+    iterator end() { return iterator(slots.data(), distances.data(), slots.size(), slots.size()); }
+    const_iterator begin() const { return const_iterator(slots.data(), distances.data(), 0, slots.size()); }
+    const_iterator end() const { return const_iterator(slots.data(), distances.data(), slots.size(), slots.size()); }
+
+    // Operation counters from the tracing policy (all zero under NoTrace)
+    using Trace::traceStats;
+    using Trace::resetTraceStats;
+
+    // Keeps the slot array so the table can be refilled without reallocating
+    void clear() {
+        for (size_t i = 0; i < slots.size(); i++) {
+            if (distances[i] != 0) {
+                slots[i] = Slot();
+                distances[i] = 0;
+            }
+        }
+        count = 0;
+        this->traceLog([&](std::ostream& os) { os << "[DSA-HashTable] Cleared hash table"; });
     }
 };
@@ -3,93 +3,241 @@
 #include <iostream>
 #include <stdexcept>
 #include <algorithm>
+#include <functional>
+#include <utility>
+#include <cstddef>
+#include "TracePolicy.h"
+
+// CHANGE: 2026-10-16 - Indexed d-ary heap
+// - insert/emplace return a Handle that stays valid until the element leaves the heap
+// - update/decreaseKey/erase by handle (O(log_d n)), so Dijkstra no longer needs duplicates
+// - Elements are moved, never copied, so move-only types work
+// - Arity defaults to 2; 4 is usually faster for priority queues (shallower, cache-friendly children)
+// Compare keeps its old meaning: with std::less the largest element is on top,
+// with std::greater the smallest is.
+template<typename T, typename Compare = std::less<T>, size_t Arity = 2, typename Trace = DefaultTrace>
+class Heap : private Trace {
+    static_assert(Arity >= 2, "Heap arity must be at least 2");
+
+public:
+    using Handle = size_t;
+    static constexpr Handle INVALID_HANDLE = static_cast<Handle>(-1);
 
-template<typename T, typename Compare = std::less<T>>
-class Heap {
 private:
-    std::vector<T> data;
+    std::vector<T> data;             // Heap order
+    std::vector<Handle> handleAt;    // heap index -> handle
+    std::vector<size_t> position;    // handle -> heap index (NOT_IN_HEAP when free)
+    std::vector<Handle> freeHandles;
     Compare comp;
-    
+
+    static constexpr size_t NOT_IN_HEAP = static_cast<size_t>(-1);
+
+    // True if a should sit above b
+    bool before(const T& a, const T& b) const {
+        this->traceCompare();
+        return comp(b, a);
+    }
+
+    void place(size_t index, T&& value, Handle handle) {
+        data[index] = std::move(value);
+        handleAt[index] = handle;
+        position[handle] = index;
+    }
+
+    // Hole-based sifting: the moving element is held aside and written once
     void heapifyUp(size_t index) {
+        T value = std::move(data[index]);
+        Handle handle = handleAt[index];
+
         while (index > 0) {
-            size_t parent = (index - 1) / 2;
-            if (comp(data[parent], data[index])) {
-                std::swap(data[parent], data[index]);
-                index = parent;
-            } else {
-                break;
-            }
+            size_t parent = (index - 1) / Arity;
+            if (!before(value, data[parent])) break;
+            place(index, std::move(data[parent]), handleAt[parent]);
+            index = parent;
         }
+        place(index, std::move(value), handle);
     }
-    
+
     void heapifyDown(size_t index) {
-        size_t size = data.size();
+        const size_t size = data.size();
+        T value = std::move(data[index]);
+        Handle handle = handleAt[index];
+
         while (true) {
-            size_t largest = index;
-            size_t left = 2 * index + 1;
-            size_t right = 2 * index + 2;
-            
-            if (left < size && comp(data[largest], data[left])) {
-                largest = left;
-            }
-            if (right < size && comp(data[largest], data[right])) {
-                largest = right;
+            size_t first = index * Arity + 1;
+            if (first >= size) break;
+
+            size_t best = first;
+            size_t last = std::min(first + Arity, size);
+            for (size_t child = first + 1; child < last; child++) {
+                if (before(data[child], data[best])) best = child;
             }
-            
-            if (largest != index) {
-                std::swap(data[index], data[largest]);
-                index = largest;
+
+            if (!before(data[best], value)) break;
+            place(index, std::move(data[best]), handleAt[best]);
+            index = best;
+        }
+        place(index, std::move(value), handle);
+    }
+
+    Handle acquireHandle() {
+        if (!freeHandles.empty()) {
+            Handle handle = freeHandles.back();
+            freeHandles.pop_back();
+            return handle;
+        }
+        position.push_back(NOT_IN_HEAP);
+        return position.size() - 1;
+    }
+
+    Handle push(T&& value) {
+        Handle handle = acquireHandle();
+        data.push_back(std::move(value));
+        handleAt.push_back(handle);
+        position[handle] = data.size() - 1;
+        heapifyUp(data.size() - 1);
+        this->traceInsert(data.size());
+        // CHANGE: 2025-11-14 - Reduce console spam during gameplay loops
+        // std::cout << "[DSA-Heap] Inserted element. Heap size: " << data.size() << std::endl;
+        return handle;
+    }
+
+    // Remove the element at a heap index and return it
+    T removeAt(size_t index) {
+        Handle handle = handleAt[index];
+        T removed = std::move(data[index]);
+        position[handle] = NOT_IN_HEAP;
+        freeHandles.push_back(handle);
+
+        size_t lastIndex = data.size() - 1;
+        if (index != lastIndex) {
+            place(index, std::move(data[lastIndex]), handleAt[lastIndex]);
+        }
+        data.pop_back();
+        handleAt.pop_back();
+
+        if (index < data.size()) {
+            // The filler came from the bottom; it may belong above or below
+            if (index > 0 && before(data[index], data[(index - 1) / Arity])) {
+                heapifyUp(index);
             } else {
-                break;
+                heapifyDown(index);
             }
         }
+        this->traceRemove(data.size());
+        return removed;
+    }
+
+    void checkHandle(Handle handle) const {
+        if (!contains(handle)) {
+            throw std::out_of_range("Heap handle is not in the heap");
+        }
     }
 
 public:
     Heap() = default;
-    
-    void insert(const T& value) {
-        data.push_back(value);
-        heapifyUp(data.size() - 1);
-        // CHANGE: 2025-11-14 - Reduce console spam during gameplay loops
-        // std::cout << "[DSA-Heap] Inserted element. Heap size: " << data.size() << std::endl;
+    explicit Heap(const Compare& compare) : comp(compare) {}
+
+    Handle insert(const T& value) {
+        return push(T(value));
+    }
+
+    Handle insert(T&& value) {
+        return push(std::move(value));
     }
-    
+
+    template<typename... Args>
+    Handle emplace(Args&&... args) {
+        return push(T(std::forward<Args>(args)...));
+    }
+
     T extractTop() {
         if (isEmpty()) {
             throw std::out_of_range("Heap is empty");
         }
-        
-        T top = data[0];
-        data[0] = data.back();
-        data.pop_back();
-        
-        if (!isEmpty()) {
-            heapifyDown(0);
-        }
-        
         // CHANGE: 2025-11-14 - Reduce console spam during gameplay loops
         // std::cout << "[DSA-Heap] Extracted top element. Heap size: " << data.size() << std::endl;
-        return top;
+        return removeAt(0);
+    }
+
+    void pop() {
+        extractTop();
     }
-    
+
     const T& top() const {
         if (isEmpty()) {
             throw std::out_of_range("Heap is empty");
         }
         return data[0];
     }
-    
+
+    Handle topHandle() const {
+        if (isEmpty()) {
+            throw std::out_of_range("Heap is empty");
+        }
+        return handleAt[0];
+    }
+
+    bool contains(Handle handle) const {
+        return handle < position.size() && position[handle] != NOT_IN_HEAP;
+    }
+
+    const T& get(Handle handle) const {
+        checkHandle(handle);
+        return data[position[handle]];
+    }
+
+    // Replace an element's value; it moves up or down as needed
+    void update(Handle handle, T value) {
+        checkHandle(handle);
+        size_t index = position[handle];
+        bool movesUp = before(value, data[index]);
+        data[index] = std::move(value);
+        if (movesUp) {
+            heapifyUp(index);
+        } else {
+            heapifyDown(index);
+        }
+    }
+
+    // Replace an element with one that belongs nearer the top
+    // (a smaller key in a std::greater min-heap). Cheaper than update().
+    void decreaseKey(Handle handle, T value) {
+        checkHandle(handle);
+        size_t index = position[handle];
+        data[index] = std::move(value);
+        heapifyUp(index);
+    }
+
+    T erase(Handle handle) {
+        checkHandle(handle);
+        return removeAt(position[handle]);
+    }
+
+    void reserve(size_t n) {
+        data.reserve(n);
+        handleAt.reserve(n);
+        position.reserve(n);
+    }
+
     bool isEmpty() const {
         return data.empty();
     }
-    
+
     size_t size() const {
         return data.size();
     }
-    
+
+    // Operation counters from the tracing policy (all zero under NoTrace)
+    using Trace::traceStats;
+    using Trace::resetTraceStats;
+
+    // All handles become invalid
     void clear() {
         data.clear();
+        handleAt.clear();
+        position.clear();
+        freeHandles.clear();
         // CHANGE: 2025-11-14 - Reduce console spam during gameplay
         // std::cout << "[DSA-Heap] Cleared heap" << std::endl;
     }
@@ -2,97 +2,324 @@
 #include <iostream>
 #include <memory>
 #include <functional>
+#include <iterator>
+#include <new>
+#include <utility>
+#include <vector>
+#include <cstddef>
+#include "TracePolicy.h"
 
-template<typename T>
-class LinkedList {
+// CHANGE: 2026-10-16 - Pool-backed singly linked list
+// - Nodes come from a per-list free-list pool (blocks of nodes, never returned
+//   to the heap until the list dies), so no shared_ptr refcounting per step
+// - Head and tail pointers: append() is O(1)
+// - Forward iterators work with range-for and <algorithm>
+// - traverse() and find_if() take any callable, no std::function
+// Iterators to an element stay valid until that element is removed.
+template<typename T, typename Trace = DefaultTrace>
+class LinkedList : private Trace {
 private:
     struct Node {
-        T data;
-        std::shared_ptr<Node> next;
-        
-        Node(const T& value) : data(value), next(nullptr) {}
+        Node* next;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T& value() { return *std::launder(reinterpret_cast<T*>(storage)); }
+        const T& value() const { return *std::launder(reinterpret_cast<const T*>(storage)); }
+    };
+
+    // Free-list allocator. Blocks double in size up to MAX_BLOCK nodes.
+    class NodePool {
+    public:
+        NodePool() = default;
+        NodePool(const NodePool&) = delete;
+        NodePool& operator=(const NodePool&) = delete;
+
+        NodePool(NodePool&& other) noexcept
+            : blocks(std::move(other.blocks)), freeList(other.freeList), nextBlockSize(other.nextBlockSize) {
+            other.reset();
+        }
+
+        NodePool& operator=(NodePool&& other) noexcept {
+            blocks = std::move(other.blocks);
+            freeList = other.freeList;
+            nextBlockSize = other.nextBlockSize;
+            other.reset();
+            return *this;
+        }
+
+        Node* allocate() {
+            if (!freeList) grow();
+            Node* node = freeList;
+            freeList = node->next;
+            return node;
+        }
+
+        void release(Node* node) {
+            node->next = freeList;
+            freeList = node;
+        }
+
+    private:
+        static constexpr size_t FIRST_BLOCK = 8;
+        static constexpr size_t MAX_BLOCK = 1024;
+
+        std::vector<std::unique_ptr<Node[]>> blocks;
+        Node* freeList = nullptr;
+        size_t nextBlockSize = FIRST_BLOCK;
+
+        void reset() {
+            blocks.clear();
+            freeList = nullptr;
+            nextBlockSize = FIRST_BLOCK;
+        }
+
+        void grow() {
+            blocks.emplace_back(new Node[nextBlockSize]);
+            Node* block = blocks.back().get();
+            for (size_t i = 0; i < nextBlockSize; i++) {
+                block[i].next = (i + 1 < nextBlockSize) ? &block[i + 1] : freeList;
+            }
+            freeList = block;
+            if (nextBlockSize < MAX_BLOCK) nextBlockSize *= 2;
+        }
     };
-    
-    std::shared_ptr<Node> head;
+
+    Node* head;
+    Node* tail;
     size_t listSize;
+    NodePool pool;
+
+    template<typename... Args>
+    Node* createNode(Args&&... args) {
+        Node* node = pool.allocate();
+        try {
+            ::new (static_cast<void*>(node->storage)) T(std::forward<Args>(args)...);
+        } catch (...) {
+            pool.release(node);
+            throw;
+        }
+        node->next = nullptr;
+        return node;
+    }
+
+    void destroyNode(Node* node) {
+        node->value().~T();
+        pool.release(node);
+    }
+
+    // Unlink the node after prev (prev == nullptr means head)
+    void unlinkAfter(Node* prev) {
+        Node* victim = prev ? prev->next : head;
+        if (prev) {
+            prev->next = victim->next;
+        } else {
+            head = victim->next;
+        }
+        if (victim == tail) tail = prev;
+        destroyNode(victim);
+        listSize--;
+        this->traceRemove(listSize);
+    }
+
+    void linkFront(Node* node) {
+        node->next = head;
+        head = node;
+        if (!tail) tail = node;
+        listSize++;
+        this->traceInsert(listSize);
+    }
+
+    void linkBack(Node* node) {
+        if (tail) {
+            tail->next = node;
+        } else {
+            head = node;
+        }
+        tail = node;
+        listSize++;
+        this->traceInsert(listSize);
+    }
 
 public:
-    LinkedList() : head(nullptr), listSize(0) {}
-    
+    template<typename NodeT, typename Ref, typename Ptr>
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using reference = Ref;
+        using pointer = Ptr;
+
+        Iterator() : node(nullptr) {}
+        explicit Iterator(NodeT* n) : node(n) {}
+
+        // iterator -> const_iterator
+        template<typename N, typename R, typename P>
+        Iterator(const Iterator<N, R, P>& other) : node(other.node) {}
+
+        reference operator*() const { return node->value(); }
+        pointer operator->() const { return &node->value(); }
+        Iterator& operator++() { node = node->next; return *this; }
+        Iterator operator++(int) { Iterator old = *this; node = node->next; return old; }
+        bool operator==(const Iterator& other) const { return node == other.node; }
+        bool operator!=(const Iterator& other) const { return node != other.node; }
+
+    private:
+        template<typename, typename, typename> friend class Iterator;
+        NodeT* node;
+    };
+
+    using iterator = Iterator<Node, T&, T*>;
+    using const_iterator = Iterator<const Node, const T&, const T*>;
+
+    LinkedList() : head(nullptr), tail(nullptr), listSize(0) {}
+
+    LinkedList(const LinkedList& other) : LinkedList() {
+        for (const T& value : other) append(value);
+    }
+
+    LinkedList(LinkedList&& other) noexcept
+        : head(other.head), tail(other.tail), listSize(other.listSize), pool(std::move(other.pool)) {
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.listSize = 0;
+    }
+
+    LinkedList& operator=(const LinkedList& other) {
+        if (this != &other) {
+            clear();
+            for (const T& value : other) append(value);
+        }
+        return *this;
+    }
+
+    LinkedList& operator=(LinkedList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            head = other.head;
+            tail = other.tail;
+            listSize = other.listSize;
+            pool = std::move(other.pool);
+            other.head = nullptr;
+            other.tail = nullptr;
+            other.listSize = 0;
+        }
+        return *this;
+    }
+
+    ~LinkedList() {
+        for (Node* node = head; node; ) {
+            Node* next = node->next;
+            node->value().~T();
+            node = next;
+        }
+    }
+
     void insert(const T& value) {
-        auto newNode = std::make_shared<Node>(value);
-        newNode->next = head;
-        head = newNode;
-        listSize++;
+        linkFront(createNode(value));
         // CHANGE: 2025-11-14 - Reduce console spam by removing verbose logging in release builds
         // std::cout << "[DSA-LinkedList] Inserted element. List size: " << listSize << std::endl;
     }
-    
+
     void append(const T& value) {
-        auto newNode = std::make_shared<Node>(value);
-        
-        if (!head) {
-            head = newNode;
-        } else {
-            auto current = head;
-            while (current->next) {
-                current = current->next;
-            }
-            current->next = newNode;
-        }
-        listSize++;
+        linkBack(createNode(value));
         // CHANGE: 2025-11-14 - Reduce console spam
         // std::cout << "[DSA-LinkedList] Appended element. List size: " << listSize << std::endl;
     }
-    
+
+    template<typename... Args>
+    T& emplace_front(Args&&... args) {
+        Node* node = createNode(std::forward<Args>(args)...);
+        linkFront(node);
+        return node->value();
+    }
+
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        Node* node = createNode(std::forward<Args>(args)...);
+        linkBack(node);
+        return node->value();
+    }
+
+    // Removes the first element equal to value
     bool remove(const T& value) {
-        if (!head) return false;
-        
-        if (head->data == value) {
-            head = head->next;
-            listSize--;
-            // std::cout << "[DSA-LinkedList] Removed element. List size: " << listSize << std::endl;
-            return true;
-        }
-        
-        auto current = head;
-        while (current->next && current->next->data != value) {
-            current = current->next;
-        }
-        
-        if (current->next) {
-            current->next = current->next->next;
-            listSize--;
-            // std::cout << "[DSA-LinkedList] Removed element. List size: " << listSize << std::endl;
-            return true;
-        }
-        
+        return removeFirstIf([&](const T& item) { return item == value; });
+    }
+
+    // Removes the first element matching pred; stops scanning as soon as it is found
+    template<typename Pred>
+    bool removeFirstIf(Pred&& pred) {
+        Node* prev = nullptr;
+        for (Node* node = head; node; prev = node, node = node->next) {
+            this->traceCompare();
+            if (pred(node->value())) {
+                unlinkAfter(prev);
+                // std::cout << "[DSA-LinkedList] Removed element. List size: " << listSize << std::endl;
+                return true;
+            }
+        }
         return false;
     }
-    
+
     bool contains(const T& value) const {
-        auto current = head;
-        while (current) {
-            if (current->data == value) return true;
-            current = current->next;
+        this->traceLookup();
+        return find_if([&](const T& item) { return item == value; }) != end();
+    }
+
+    // First element matching pred, or end(). Stops at the first match.
+    template<typename Pred>
+    iterator find_if(Pred&& pred) {
+        this->traceLookup();
+        for (Node* node = head; node; node = node->next) {
+            this->traceCompare();
+            if (pred(node->value())) return iterator(node);
         }
-        return false;
+        return end();
     }
-    
-    void traverse(std::function<void(const T&)> func) const {
-        auto current = head;
-        while (current) {
-            func(current->data);
-            current = current->next;
+
+    template<typename Pred>
+    const_iterator find_if(Pred&& pred) const {
+        for (const Node* node = head; node; node = node->next) {
+            this->traceCompare();
+            if (pred(node->value())) return const_iterator(node);
         }
+        return end();
     }
-    
+
+    template<typename F>
+    void traverse(F&& func) const {
+        this->traceTraversal();
+        for (const Node* node = head; node; node = node->next) {
+            func(node->value());
+        }
+    }
+
+    iterator begin() { return iterator(head); }
+    iterator end() { return iterator(nullptr); }
+    const_iterator begin() const { return const_iterator(head); }
+    const_iterator end() const { return const_iterator(nullptr); }
+
+    T& front() { return head->value(); }
+    const T& front() const { return head->value(); }
+    T& back() { return tail->value(); }
+    const T& back() const { return tail->value(); }
+
     size_t size() const { return listSize; }
     bool isEmpty() const { return head == nullptr; }
-    
+
+    // Operation counters from the tracing policy (all zero under NoTrace)
+    using Trace::traceStats;
+    using Trace::resetTraceStats;
+
+    // Nodes go back to the pool for reuse
     void clear() {
-        head = nullptr;
+        while (head) {
+            Node* next = head->next;
+            destroyNode(head);
+            head = next;
+        }
+        tail = nullptr;
         listSize = 0;
-        std::cout << "[DSA-LinkedList] Cleared list" << std::endl;
+        this->traceLog([&](std::ostream& os) { os << "[DSA-LinkedList] Cleared list"; });
     }
 };
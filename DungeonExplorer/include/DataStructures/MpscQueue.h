@@ -0,0 +1,156 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include "SpscQueue.h"  // CACHE_LINE_SIZE
+
+// CHANGE: 2026-10-16 - Lock-free multi-producer/single-consumer ring buffer
+// Bounded queue after Dmitry Vyukov's design: every cell carries a sequence number,
+// producers claim a cell with one CAS on the enqueue index, and the consumer
+// knows a cell is ready when its sequence is pos + 1. Used where several
+// workers (logging, asset decoding) feed the main loop.
+// Any number of threads may enqueue; exactly one thread may consume.
+template<typename T>
+class MpscQueue {
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* value() { return std::launder(reinterpret_cast<T*>(storage)); }
+    };
+
+    const size_t mask;
+    std::unique_ptr<Cell[]> cells;
+
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueuePos{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> dequeuePos{0};  // Written by the consumer only
+
+    static size_t roundUp(size_t n) {
+        size_t capacity = 2;
+        while (capacity < n) capacity *= 2;
+        return capacity;
+    }
+
+    // Consumer: the ready cell at the dequeue position, or nullptr
+    Cell* readyCell() {
+        const size_t pos = dequeuePos.load(std::memory_order_relaxed);
+        Cell* cell = &cells[pos & mask];
+        if (cell->sequence.load(std::memory_order_acquire) != pos + 1) return nullptr;
+        return cell;
+    }
+
+    void release(Cell* cell) {
+        const size_t pos = dequeuePos.load(std::memory_order_relaxed);
+        cell->value()->~T();
+        cell->sequence.store(pos + mask + 1, std::memory_order_release);
+        dequeuePos.store(pos + 1, std::memory_order_relaxed);
+    }
+
+public:
+    explicit MpscQueue(size_t capacity)
+        : mask(roundUp(capacity) - 1), cells(new Cell[mask + 1]) {
+        for (size_t i = 0; i <= mask; i++) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    ~MpscQueue() {
+        while (Cell* cell = readyCell()) {
+            release(cell);
+        }
+    }
+
+    // ---- Producers ----
+
+    template<typename... Args>
+    bool try_emplace(Args&&... args) {
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells[pos & mask];
+            const size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;  // Full: the consumer has not freed this cell yet
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);  // Another producer took it
+            }
+        }
+        ::new (static_cast<void*>(cell->storage)) T(std::forward<Args>(args)...);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_enqueue(const T& value) { return try_emplace(value); }
+    bool try_enqueue(T&& value) { return try_emplace(std::move(value)); }
+
+    // Waits (yielding) while the queue is full
+    void enqueue(T value) {
+        while (!try_emplace(std::move(value))) {
+            std::this_thread::yield();
+        }
+    }
+
+    // ---- Consumer ----
+
+    // Empty also while a producer has claimed the next cell but not finished writing it
+    bool isEmpty() {
+        return readyCell() == nullptr;
+    }
+
+    T& front() {
+        Cell* cell = readyCell();
+        if (!cell) throw std::out_of_range("Queue is empty");
+        return *cell->value();
+    }
+
+    void dequeue() {
+        Cell* cell = readyCell();
+        if (!cell) throw std::out_of_range("Queue is empty");
+        release(cell);
+    }
+
+    bool try_dequeue(T& out) {
+        Cell* cell = readyCell();
+        if (!cell) return false;
+        out = std::move(*cell->value());
+        release(cell);
+        return true;
+    }
+
+    // Hand up to maxItems ready elements to f(T&&). Returns the number drained.
+    template<typename F>
+    size_t drain(F&& f, size_t maxItems = static_cast<size_t>(-1)) {
+        size_t drained = 0;
+        while (drained < maxItems) {
+            Cell* cell = readyCell();
+            if (!cell) break;
+            f(std::move(*cell->value()));
+            release(cell);
+            drained++;
+        }
+        return drained;
+    }
+
+    // Approximate while producers are running
+    size_t size() const {
+        const size_t tail = dequeuePos.load(std::memory_order_relaxed);
+        const size_t head = enqueuePos.load(std::memory_order_relaxed);
+        return head >= tail ? head - tail : 0;
+    }
+
+    size_t capacity() const {
+        return mask + 1;
+    }
+};
@@ -2,9 +2,10 @@
 #include <deque>
 #include <iostream>
 #include <stdexcept>
+#include "TracePolicy.h"
 
-template<typename T>
-class Queue {
+template<typename T, typename Trace = DefaultTrace>
+class Queue : private Trace {
 private:
     std::deque<T> data;
 
@@ -13,7 +14,8 @@ public:
     
     void enqueue(const T& value) {
         data.push_back(value);
-        std::cout << "[DSA-Queue] Enqueued element. Queue size: " << data.size() << std::endl;
+        this->traceInsert(data.size());
+        this->traceLog([&](std::ostream& os) { os << "[DSA-Queue] Enqueued element. Queue size: " << data.size(); });
     }
     
     void dequeue() {
@@ -21,7 +23,8 @@ public:
             throw std::out_of_range("Queue is empty");
         }
         data.pop_front();
-        std::cout << "[DSA-Queue] Dequeued element. Queue size: " << data.size() << std::endl;
+        this->traceRemove(data.size());
+        this->traceLog([&](std::ostream& os) { os << "[DSA-Queue] Dequeued element. Queue size: " << data.size(); });
     }
     
     T& front() {
@@ -46,8 +49,12 @@ public:
         return data.size();
     }
     
+    // Operation counters from the tracing policy (all zero under NoTrace)
+    using Trace::traceStats;
+    using Trace::resetTraceStats;
+    
     void clear() {
         data.clear();
-        std::cout << "[DSA-Queue] Cleared queue" << std::endl;
+        this->traceLog([&](std::ostream& os) { os << "[DSA-Queue] Cleared queue"; });
     }
 };
@@ -0,0 +1,114 @@
+#pragma once
+#include <vector>
+#include <array>
+#include <utility>
+#include <stdexcept>
+#include <cstdint>
+#include <cstddef>
+#include "TracePolicy.h"
+
+// CHANGE: 2026-10-16 - Monotone radix heap for small non-negative integer keys
+// A min-priority queue that only requires every pushed key to be >= the last popped key,
+// which holds for Dijkstra (and A* with a consistent heuristic) on non-negative weights.
+// Keys go into bucket = bit width of (key XOR lastPopped); each element is moved
+// down at most 32 times in total, so push is O(1) and pop is amortized O(log C).
+template<typename V, typename Trace = DefaultTrace>
+class RadixHeap : private Trace {
+public:
+    using Key = uint32_t;
+
+private:
+    static constexpr size_t BUCKETS = 33;
+
+    std::array<std::vector<std::pair<Key, V>>, BUCKETS> buckets;
+    Key last = 0;  // Last popped key (all stored keys are >= last)
+    size_t count = 0;
+
+    static size_t bitWidth(Key x) {
+        size_t width = 0;
+        while (x != 0) {
+            width++;
+            x >>= 1;
+        }
+        return width;
+    }
+
+    size_t bucketFor(Key key) const {
+        return bitWidth(key ^ last);
+    }
+
+    // Refill bucket 0 from the first non-empty bucket
+    void redistribute() {
+        size_t i = 1;
+        while (buckets[i].empty()) i++;
+
+        Key newLast = buckets[i][0].first;
+        for (const auto& entry : buckets[i]) {
+            this->traceCompare();
+            if (entry.first < newLast) newLast = entry.first;
+        }
+        last = newLast;
+
+        // Every entry lands in a strictly lower bucket
+        for (auto& entry : buckets[i]) {
+            this->traceProbe();
+            buckets[bucketFor(entry.first)].push_back(std::move(entry));
+        }
+        buckets[i].clear();
+    }
+
+public:
+    RadixHeap() = default;
+
+    void push(Key key, V value) {
+        if (key < last) {
+            throw std::invalid_argument("RadixHeap keys must not decrease below the last popped key");
+        }
+        buckets[bucketFor(key)].emplace_back(key, std::move(value));
+        count++;
+        this->traceInsert(count);
+    }
+
+    // Smallest key currently stored
+    Key topKey() {
+        if (isEmpty()) {
+            throw std::out_of_range("RadixHeap is empty");
+        }
+        if (buckets[0].empty()) redistribute();
+        return last;
+    }
+
+    std::pair<Key, V> pop() {
+        if (isEmpty()) {
+            throw std::out_of_range("RadixHeap is empty");
+        }
+        if (buckets[0].empty()) redistribute();
+
+        std::pair<Key, V> top = std::move(buckets[0].back());
+        buckets[0].pop_back();
+        count--;
+        this->traceRemove(count);
+        return top;
+    }
+
+    bool isEmpty() const {
+        return count == 0;
+    }
+
+    size_t size() const {
+        return count;
+    }
+
+    // Operation counters from the tracing policy (all zero under NoTrace)
+    using Trace::traceStats;
+    using Trace::resetTraceStats;
+
+    // Keeps bucket capacity so repeated searches do not reallocate
+    void clear() {
+        for (auto& bucket : buckets) {
+            bucket.clear();
+        }
+        last = 0;
+        count = 0;
+    }
+};
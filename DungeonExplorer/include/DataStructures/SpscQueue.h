@@ -0,0 +1,152 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <cstddef>
+
+// CHANGE: 2026-10-16 - Lock-free single-producer/single-consumer ring buffer
+// Handoff channel from one background worker to the main loop (or back).
+// - Fixed capacity (rounded up to a power of two), no allocation after construction
+// - Producer and consumer indices live on separate cache lines; each side also
+//   caches the other's index so the common case touches no shared line
+// - Same vocabulary as Queue<T>: enqueue/front/dequeue, plus try_* and drain()
+// Exactly one thread may call the producer functions and one the consumer functions.
+// No tracing policy: the counters would be a data race between the two threads.
+
+inline constexpr size_t CACHE_LINE_SIZE = 64;
+
+template<typename T>
+class SpscQueue {
+private:
+    struct alignas(T) Slot {
+        unsigned char storage[sizeof(T)];
+    };
+
+    const size_t mask;
+    std::unique_ptr<Slot[]> slots;
+
+    // Consumer side
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> head{0};
+    size_t cachedTail = 0;
+
+    // Producer side
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail{0};
+    size_t cachedHead = 0;
+
+    static size_t roundUp(size_t n) {
+        size_t capacity = 2;
+        while (capacity < n) capacity *= 2;
+        return capacity;
+    }
+
+    T* slotAt(size_t index) const {
+        return std::launder(reinterpret_cast<T*>(slots[index & mask].storage));
+    }
+
+public:
+    explicit SpscQueue(size_t capacity)
+        : mask(roundUp(capacity) - 1), slots(new Slot[mask + 1]) {}
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    ~SpscQueue() {
+        size_t h = head.load(std::memory_order_relaxed);
+        const size_t t = tail.load(std::memory_order_relaxed);
+        for (; h != t; h++) {
+            slotAt(h)->~T();
+        }
+    }
+
+    // ---- Producer ----
+
+    template<typename... Args>
+    bool try_emplace(Args&&... args) {
+        const size_t t = tail.load(std::memory_order_relaxed);
+        if (t - cachedHead > mask) {
+            cachedHead = head.load(std::memory_order_acquire);
+            if (t - cachedHead > mask) return false;  // Full
+        }
+        ::new (static_cast<void*>(slots[t & mask].storage)) T(std::forward<Args>(args)...);
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_enqueue(const T& value) { return try_emplace(value); }
+    bool try_enqueue(T&& value) { return try_emplace(std::move(value)); }
+
+    // Waits (yielding) while the queue is full
+    void enqueue(T value) {
+        while (!try_emplace(std::move(value))) {
+            std::this_thread::yield();
+        }
+    }
+
+    // ---- Consumer ----
+
+    bool isEmpty() const {
+        return head.load(std::memory_order_relaxed) == tail.load(std::memory_order_acquire);
+    }
+
+    T& front() {
+        const size_t h = head.load(std::memory_order_relaxed);
+        if (h == cachedTail) {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (h == cachedTail) throw std::out_of_range("Queue is empty");
+        }
+        return *slotAt(h);
+    }
+
+    void dequeue() {
+        front();  // Throws when empty
+        const size_t h = head.load(std::memory_order_relaxed);
+        slotAt(h)->~T();
+        head.store(h + 1, std::memory_order_release);
+    }
+
+    bool try_dequeue(T& out) {
+        const size_t h = head.load(std::memory_order_relaxed);
+        if (h == cachedTail) {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (h == cachedTail) return false;
+        }
+        T* value = slotAt(h);
+        out = std::move(*value);
+        value->~T();
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Hand up to maxItems elements to f(T&&) and release their slots in one store.
+    // Returns the number drained. Meant for the once-per-frame pump in the main loop.
+    template<typename F>
+    size_t drain(F&& f, size_t maxItems = static_cast<size_t>(-1)) {
+        const size_t h = head.load(std::memory_order_relaxed);
+        cachedTail = tail.load(std::memory_order_acquire);
+        size_t available = cachedTail - h;
+        if (available > maxItems) available = maxItems;
+
+        for (size_t i = 0; i < available; i++) {
+            T* value = slotAt(h + i);
+            f(std::move(*value));
+            value->~T();
+        }
+        head.store(h + available, std::memory_order_release);
+        return available;
+    }
+
+    // ---- Either side (approximate while the other side is running) ----
+
+    size_t size() const {
+        // head first: it can only catch up with tail, so the difference never underflows
+        const size_t h = head.load(std::memory_order_acquire);
+        return tail.load(std::memory_order_acquire) - h;
+    }
+
+    size_t capacity() const {
+        return mask + 1;
+    }
+};
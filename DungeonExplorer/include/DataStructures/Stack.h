@@ -2,9 +2,10 @@
 #include <vector>
 #include <iostream>
 #include <stdexcept>
+#include "TracePolicy.h"
 
-template<typename T>
-class Stack {
+template<typename T, typename Trace = DefaultTrace>
+class Stack : private Trace {
 private:
     std::vector<T> data;
 
@@ -13,6 +14,7 @@ public:
     
     void push(const T& value) {
         data.push_back(value);
+        this->traceInsert(data.size());
         // CHANGE: 2025-11-14 - Reduce console spam during gameplay loops
         // std::cout << "[DSA-Stack] Pushed element. Stack size: " << data.size() << std::endl;
     }
@@ -22,6 +24,7 @@ public:
             throw std::out_of_range("Stack is empty");
         }
         data.pop_back();
+        this->traceRemove(data.size());
         // CHANGE: 2025-11-14 - Reduce console spam during gameplay loops
         // std::cout << "[DSA-Stack] Popped element. Stack size: " << data.size() << std::endl;
     }
@@ -48,6 +51,10 @@ public:
         return data.size();
     }
     
+    // Operation counters from the tracing policy (all zero under NoTrace)
+    using Trace::traceStats;
+    using Trace::resetTraceStats;
+    
     void clear() {
         data.clear();
         // CHANGE: 2025-11-14 - Reduce console spam during gameplay
@@ -0,0 +1,87 @@
+#pragma once
+#include <iostream>
+#include <cstddef>
+
+// CHANGE: 2026-10-16 - Compile-time tracing policies for the DataStructures templates
+// Containers inherit privately from their policy (empty base optimization), so
+// NoTrace adds no storage and every hook inlines away to nothing.
+//
+//   NoTrace       - no output, no counting
+//   CountingTrace - operation, probe/comparison and peak-size counters (TraceStats)
+//   LoggingTrace  - CountingTrace plus the educational "[DSA-...]" console output
+
+struct TraceStats {
+    size_t inserts = 0;
+    size_t removals = 0;
+    size_t lookups = 0;
+    size_t traversals = 0;
+    size_t probes = 0;       // Slots, nodes or edges examined
+    size_t comparisons = 0;  // Key/priority comparisons
+    size_t peakSize = 0;
+
+    void print(std::ostream& os, const char* name) const {
+        os << "  - " << name << ": " << inserts << " inserts, " << removals << " removals, "
+           << lookups << " lookups, " << traversals << " traversals, "
+           << probes << " probes, " << comparisons << " comparisons, peak size " << peakSize << "\n";
+    }
+};
+
+struct NoTrace {
+    static constexpr bool counts = false;
+
+    void traceInsert(size_t) const {}
+    void traceRemove(size_t) const {}
+    void traceLookup() const {}
+    void traceTraversal() const {}
+    void traceProbe(size_t = 1) const {}
+    void traceCompare(size_t = 1) const {}
+
+    // The message lambda is never called, so no formatting work is done
+    template<typename F>
+    void traceLog(F&&) const {}
+
+    const TraceStats& traceStats() const {
+        static const TraceStats empty;
+        return empty;
+    }
+    void resetTraceStats() const {}
+};
+
+struct CountingTrace {
+    static constexpr bool counts = true;
+
+    // Counters may be bumped from const lookups
+    mutable TraceStats stats;
+
+    void traceInsert(size_t newSize) const {
+        stats.inserts++;
+        if (newSize > stats.peakSize) stats.peakSize = newSize;
+    }
+    void traceRemove(size_t) const { stats.removals++; }
+    void traceLookup() const { stats.lookups++; }
+    void traceTraversal() const { stats.traversals++; }
+    void traceProbe(size_t n = 1) const { stats.probes += n; }
+    void traceCompare(size_t n = 1) const { stats.comparisons += n; }
+
+    template<typename F>
+    void traceLog(F&&) const {}
+
+    const TraceStats& traceStats() const { return stats; }
+    void resetTraceStats() const { stats = TraceStats(); }
+};
+
+struct LoggingTrace : CountingTrace {
+    // F is called as f(std::ostream&) and writes one line without a newline
+    template<typename F>
+    void traceLog(F&& message) const {
+        message(std::cout);
+        std::cout << '\n';
+    }
+};
+
+// Debug builds keep the educational output; release builds pay nothing
+#ifdef NDEBUG
+using DefaultTrace = NoTrace;
+#else
+using DefaultTrace = LoggingTrace;
+#endif
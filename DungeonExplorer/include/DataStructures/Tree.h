@@ -1,102 +1,273 @@
 #pragma once
 #include <iostream>
-#include <memory>
-#include <functional>
-#include <queue>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include "TracePolicy.h"
 
-template<typename T>
-class BinaryTree {
+// CHANGE: 2026-10-16 - Array-backed binary tree
+// - Nodes live in one contiguous vector and refer to each other by index
+//   (left, right, parent), so no shared_ptr per node
+// - Handles are those indices: stable until the node's subtree is replaced or removed
+// - inorder/preorder/postorder walk the parent links (no recursion, no stack),
+//   levelOrder uses one scratch vector; all take any callable, no std::function
+// - forEach/findIf scan the node array linearly in insertion order, for callers
+//   that do not care about tree order
+template<typename T, typename Trace = DefaultTrace>
+class BinaryTree : private Trace {
 public:
+    using Handle = uint32_t;
+    static constexpr Handle INVALID_HANDLE = static_cast<Handle>(-1);
+
+private:
     struct Node {
         T data;
-        std::shared_ptr<Node> left;
-        std::shared_ptr<Node> right;
-        
-        Node(const T& value) : data(value), left(nullptr), right(nullptr) {}
+        Handle left;
+        Handle right;
+        Handle parent;
+        bool live;
     };
-    
-private:
-    std::shared_ptr<Node> root;
-    
-    void inorderTraversal(std::shared_ptr<Node> node, std::function<void(const T&)> func) const {
-        if (!node) return;
-        inorderTraversal(node->left, func);
-        func(node->data);
-        inorderTraversal(node->right, func);
-    }
-    
-    void preorderTraversal(std::shared_ptr<Node> node, std::function<void(const T&)> func) const {
-        if (!node) return;
-        func(node->data);
-        preorderTraversal(node->left, func);
-        preorderTraversal(node->right, func);
-    }
-    
-    void postorderTraversal(std::shared_ptr<Node> node, std::function<void(const T&)> func) const {
-        if (!node) return;
-        postorderTraversal(node->left, func);
-        postorderTraversal(node->right, func);
-        func(node->data);
+
+    std::vector<Node> nodes;
+    std::vector<Handle> freeSlots;   // Slots of removed subtrees, reused by later inserts
+    Handle root = INVALID_HANDLE;
+    size_t nodeCount = 0;
+
+    Handle allocate(const T& value, Handle parent) {
+        Handle handle;
+        if (!freeSlots.empty()) {
+            handle = freeSlots.back();
+            freeSlots.pop_back();
+            nodes[handle] = Node{value, INVALID_HANDLE, INVALID_HANDLE, parent, true};
+        } else {
+            handle = static_cast<Handle>(nodes.size());
+            nodes.push_back(Node{value, INVALID_HANDLE, INVALID_HANDLE, parent, true});
+        }
+        this->traceInsert(++nodeCount);
+        return handle;
+    }
+
+    // Free every node of the subtree rooted at handle
+    void release(Handle handle) {
+        if (handle == INVALID_HANDLE) return;
+        std::vector<Handle> pending{handle};
+        while (!pending.empty()) {
+            Handle current = pending.back();
+            pending.pop_back();
+            Node& node = nodes[current];
+            if (node.left != INVALID_HANDLE) pending.push_back(node.left);
+            if (node.right != INVALID_HANDLE) pending.push_back(node.right);
+            node.live = false;
+            node.left = node.right = node.parent = INVALID_HANDLE;
+            freeSlots.push_back(current);
+            this->traceRemove(--nodeCount);
+        }
+    }
+
+    Handle insertChild(Handle parent, Handle Node::*side, const T& value) {
+        if (!isValid(parent)) return INVALID_HANDLE;
+        release(nodes[parent].*side);
+        Handle child = allocate(value, parent);
+        nodes[parent].*side = child;   // After allocate: push_back may have moved the nodes
+        return child;
+    }
+
+    // First node of the subtree in postorder: keep descending, left first
+    Handle firstPostorder(Handle handle) const {
+        while (true) {
+            const Node& node = nodes[handle];
+            if (node.left != INVALID_HANDLE) handle = node.left;
+            else if (node.right != INVALID_HANDLE) handle = node.right;
+            else return handle;
+        }
+    }
+
+    Handle leftmost(Handle handle) const {
+        while (nodes[handle].left != INVALID_HANDLE) handle = nodes[handle].left;
+        return handle;
     }
 
 public:
-    BinaryTree() : root(nullptr) {}
-    
-    std::shared_ptr<Node> getRoot() { return root; }
-    const std::shared_ptr<Node> getRoot() const { return root; }
-    
-    void setRoot(const T& value) {
-        root = std::make_shared<Node>(value);
-        std::cout << "[DSA-Tree] Set root node" << std::endl;
-    }
-    
-    std::shared_ptr<Node> insertLeft(std::shared_ptr<Node> parent, const T& value) {
-        if (!parent) return nullptr;
-        parent->left = std::make_shared<Node>(value);
-        std::cout << "[DSA-Tree] Inserted left child" << std::endl;
-        return parent->left;
-    }
-    
-    std::shared_ptr<Node> insertRight(std::shared_ptr<Node> parent, const T& value) {
-        if (!parent) return nullptr;
-        parent->right = std::make_shared<Node>(value);
-        std::cout << "[DSA-Tree] Inserted right child" << std::endl;
-        return parent->right;
-    }
-    
-    void inorder(std::function<void(const T&)> func) const {
-        std::cout << "[DSA-Tree] Inorder traversal" << std::endl;
-        inorderTraversal(root, func);
-    }
-    
-    void preorder(std::function<void(const T&)> func) const {
-        std::cout << "[DSA-Tree] Preorder traversal" << std::endl;
-        preorderTraversal(root, func);
-    }
-    
-    void postorder(std::function<void(const T&)> func) const {
-        std::cout << "[DSA-Tree] Postorder traversal" << std::endl;
-        postorderTraversal(root, func);
-    }
-    
-    void levelOrder(std::function<void(const T&)> func) const {
-        if (!root) return;
-        std::cout << "[DSA-Tree] Level-order traversal" << std::endl;
-        
-        std::queue<std::shared_ptr<Node>> q;
-        q.push(root);
-        
-        while (!q.empty()) {
-            auto node = q.front();
-            q.pop();
-            func(node->data);
-            
-            if (node->left) q.push(node->left);
-            if (node->right) q.push(node->right);
+    BinaryTree() = default;
+
+    Handle getRoot() const { return root; }
+
+    Handle setRoot(const T& value) {
+        clear();
+        root = allocate(value, INVALID_HANDLE);
+        this->traceLog([&](std::ostream& os) { os << "[DSA-Tree] Set root node"; });
+        return root;
+    }
+
+    // An existing child on that side is replaced together with its subtree
+    Handle insertLeft(Handle parent, const T& value) {
+        Handle child = insertChild(parent, &Node::left, value);
+        this->traceLog([&](std::ostream& os) { os << "[DSA-Tree] Inserted left child"; });
+        return child;
+    }
+
+    Handle insertRight(Handle parent, const T& value) {
+        Handle child = insertChild(parent, &Node::right, value);
+        this->traceLog([&](std::ostream& os) { os << "[DSA-Tree] Inserted right child"; });
+        return child;
+    }
+
+    // Detach and free the subtree rooted at handle
+    void removeSubtree(Handle handle) {
+        if (!isValid(handle)) return;
+        Handle parent = nodes[handle].parent;
+        if (parent == INVALID_HANDLE) {
+            clear();
+            return;
+        }
+        if (nodes[parent].left == handle) nodes[parent].left = INVALID_HANDLE;
+        else nodes[parent].right = INVALID_HANDLE;
+        release(handle);
+    }
+
+    bool isValid(Handle handle) const {
+        return handle < nodes.size() && nodes[handle].live;
+    }
+
+    T& get(Handle handle) { return nodes[handle].data; }
+    const T& get(Handle handle) const { return nodes[handle].data; }
+
+    Handle left(Handle handle) const { return nodes[handle].left; }
+    Handle right(Handle handle) const { return nodes[handle].right; }
+    Handle parent(Handle handle) const { return nodes[handle].parent; }
+
+    // ---- Tree-order traversals (stackless, via parent links) ----
+
+    template<typename F>
+    void preorder(F&& func) const {
+        this->traceLog([&](std::ostream& os) { os << "[DSA-Tree] Preorder traversal"; });
+        this->traceTraversal();
+        Handle current = root;
+        while (current != INVALID_HANDLE) {
+            const Node& node = nodes[current];
+            func(node.data);
+            if (node.left != INVALID_HANDLE) {
+                current = node.left;
+            } else if (node.right != INVALID_HANDLE) {
+                current = node.right;
+            } else {
+                // Climb until we come up from a left child whose sibling is unvisited
+                while (true) {
+                    Handle up = nodes[current].parent;
+                    if (up == INVALID_HANDLE) return;
+                    if (nodes[up].left == current && nodes[up].right != INVALID_HANDLE) {
+                        current = nodes[up].right;
+                        break;
+                    }
+                    current = up;
+                }
+            }
+        }
+    }
+
+    template<typename F>
+    void inorder(F&& func) const {
+        this->traceLog([&](std::ostream& os) { os << "[DSA-Tree] Inorder traversal"; });
+        this->traceTraversal();
+        if (root == INVALID_HANDLE) return;
+        Handle current = leftmost(root);
+        while (current != INVALID_HANDLE) {
+            func(nodes[current].data);
+            if (nodes[current].right != INVALID_HANDLE) {
+                current = leftmost(nodes[current].right);
+            } else {
+                Handle up = nodes[current].parent;
+                while (up != INVALID_HANDLE && nodes[up].right == current) {
+                    current = up;
+                    up = nodes[current].parent;
+                }
+                current = up;
+            }
         }
     }
-    
+
+    template<typename F>
+    void postorder(F&& func) const {
+        this->traceLog([&](std::ostream& os) { os << "[DSA-Tree] Postorder traversal"; });
+        this->traceTraversal();
+        if (root == INVALID_HANDLE) return;
+        Handle current = firstPostorder(root);
+        while (true) {
+            func(nodes[current].data);
+            Handle up = nodes[current].parent;
+            if (up == INVALID_HANDLE) return;
+            if (nodes[up].left == current && nodes[up].right != INVALID_HANDLE) {
+                current = firstPostorder(nodes[up].right);
+            } else {
+                current = up;
+            }
+        }
+    }
+
+    template<typename F>
+    void levelOrder(F&& func) const {
+        if (root == INVALID_HANDLE) return;
+        this->traceLog([&](std::ostream& os) { os << "[DSA-Tree] Level-order traversal"; });
+        this->traceTraversal();
+
+        std::vector<Handle> order;
+        order.reserve(nodeCount);
+        order.push_back(root);
+        for (size_t i = 0; i < order.size(); i++) {
+            const Node& node = nodes[order[i]];
+            func(node.data);
+            if (node.left != INVALID_HANDLE) order.push_back(node.left);
+            if (node.right != INVALID_HANDLE) order.push_back(node.right);
+        }
+    }
+
+    // ---- Storage-order scans ----
+
+    template<typename F>
+    void forEach(F&& func) {
+        this->traceTraversal();
+        for (Node& node : nodes) {
+            if (node.live) func(node.data);
+        }
+    }
+
+    template<typename F>
+    void forEach(F&& func) const {
+        this->traceTraversal();
+        for (const Node& node : nodes) {
+            if (node.live) func(node.data);
+        }
+    }
+
+    // Handle of the first node (in storage order) matching pred, or INVALID_HANDLE
+    template<typename Pred>
+    Handle findIf(Pred&& pred) const {
+        this->traceLookup();
+        for (size_t i = 0; i < nodes.size(); i++) {
+            if (!nodes[i].live) continue;
+            this->traceCompare();
+            if (pred(nodes[i].data)) return static_cast<Handle>(i);
+        }
+        return INVALID_HANDLE;
+    }
+
+    void reserve(size_t capacity) { nodes.reserve(capacity); }
+
+    void clear() {
+        nodes.clear();
+        freeSlots.clear();
+        root = INVALID_HANDLE;
+        nodeCount = 0;
+    }
+
+    // Operation counters from the tracing policy (all zero under NoTrace)
+    using Trace::traceStats;
+    using Trace::resetTraceStats;
+
+    size_t size() const { return nodeCount; }
+
     bool isEmpty() const {
-        return root == nullptr;
+        return root == INVALID_HANDLE;
     }
 };
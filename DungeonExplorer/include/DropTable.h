@@ -4,8 +4,8 @@
 #pragma once
 #include <vector>
 #include <string>
-#include <random>
 #include <nlohmann/json.hpp>
+#include "Random.h"
 
 // Single entry in a drop table
 struct DropEntry {
@@ -21,10 +21,11 @@ class DropTable {
 private:
     std::vector<DropEntry> entries;
     int totalWeight;
-    std::mt19937 rng;  // Random number generator
     
 public:
-    DropTable() : totalWeight(0), rng(std::random_device{}()) {}
+    // CHANGE: 2026-10-16 - No per-table engine; callers pass a stream (building a table
+    // on every kill used to construct a std::random_device each time)
+    DropTable() : totalWeight(0) {}
     
     // Add a drop entry
     void add(const std::string& item_id, int weight) {
@@ -35,13 +36,12 @@ public:
     }
     
     // Roll for a random drop (empty string if no drop)
-    std::string roll() {
+    std::string roll(RandomStream& rng) {
         if (totalWeight == 0 || entries.empty()) {
             return "";  // No drops configured
         }
         
-        std::uniform_int_distribution<int> dist(0, totalWeight - 1);
-        int r = dist(rng);
+        int r = static_cast<int>(rng.below(static_cast<uint32_t>(totalWeight)));
         
         for (const auto& entry : entries) {
             if (r < entry.weight) {
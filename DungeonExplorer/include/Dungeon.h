@@ -2,9 +2,22 @@
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <string>
+#include <cstdint>
 #include "DataStructures/Graph.h"
+#include "DataStructures/HashTable.h"
+#include "ChunkedTileMap.h"
+#include "FlowField.h"
+#include "Pathfinder.h"
+#include "Random.h"
+#include "DungeonGenerator.h"
+#include "TileMapRenderer.h"
+#include "ConnectivityIndex.h"
+#include "FieldOfView.h"
 
-enum class TileType {
+class FloorSnapshot;
+
+// CHANGE: 2026-10-16 - One byte per tile (stored in Dungeon's chunked tile map)
+enum class TileType : uint8_t {
     Empty,
     Floor,
     Wall,
@@ -15,6 +28,14 @@ enum class TileType {
     Exit
 };
 
+// CHANGE: 2026-10-16 - Goal sets with their own cached flow field
+enum class FlowGoal : uint8_t {
+    Player,
+    Stairs,
+    Loot,
+    Count
+};
+
 struct Room {
     int id;
     int x, y;
@@ -54,52 +75,155 @@ inline bool operator==(const Room& a, const Room& b) {
 
 class Dungeon {
 private:
-    static const int GRID_WIDTH = 25;
-    static const int GRID_HEIGHT = 18;
-    
-    std::vector<std::vector<TileType>> grid;
-    Graph<int> roomGraph;  // Rooms connected as graph
+    // CHANGE: 2026-10-16 - Runtime-sized floors in 64x64 chunks (was a fixed 25x18 grid)
+    // Tile bytes plus a walkability bit per tile. Unallocated chunks are solid wall.
+    // Walk bits are kept in sync by setTile/openDoor/closeDoor and rebuilt after generate().
+    ChunkedTileMap tileMap;
+    unsigned int layoutVersion;  // Bumped on every tile or walkability change
+    unsigned int floorId;        // Unique per generate() call in this process (0 = never generated)
+    // Rooms connected as graph (counts ops for the DSA report). Mutable like the other search
+    // state below: const route queries run searches, which use its scratch and counters.
+    mutable Graph<int, CountingTrace> roomGraph;
     std::vector<Room> rooms;
     std::vector<DoorData> doors;  // Track all doors in dungeon
+    // CHANGE: 2026-10-16 - Door layer: tile id (y * width + x) -> index in 'doors', so every
+    // door lookup is O(1). This is the only door list; Game queries it instead of keeping its own.
+    HashTable<int, int, NoTrace> doorIndex;
+    bool clearDoorsOpened;  // openClearableDoors() already ran on this floor
+    // CHANGE: 2026-10-16 - Baked chunk meshes for render(); tile writes after generate() mark them dirty
+    mutable TileMapRenderer tileRenderer;
     
     int startRoomId;
     int currentRoomId;
+    int stairsRoomId;
     int stairsX, stairsY;  // TASK D: Position of stairs to next floor
     
+    // CHANGE: 2026-10-16 - All-pairs room routes (dense room index, row-major n*n)
+    // Built lazily and rebuilt only when roomGraph's version changes
+    // CHANGE: 2026-10-17 - ...and only on floors of up to ROUTE_TABLE_MAX_ROOMS rooms
+    static constexpr int ROUTE_TABLE_MAX_ROOMS = 64;
+    mutable std::vector<int> routeDistance;
+    mutable std::vector<int> routeNextHop;  // -1 when unreachable
+    mutable unsigned int routeTableVersion;
+    mutable bool routeTableBuilt;
+    
+    // CHANGE: 2026-10-17 - Single-source routes: the entrance tree is kept from the stairs
+    // search in buildLayout; other sources on large floors are searched on demand (last one cached)
+    using RouteTree = Graph<int, CountingTrace>::ShortestPathTree;
+    RouteTree entranceRoutes;
+    unsigned int entranceRoutesVersion;
+    mutable RouteTree sourceRoutes;
+    mutable unsigned int sourceRoutesVersion;
+    
+    // CHANGE: 2026-10-16 - One distance map per goal set, recomputed only when the goals
+    // or the layout change, then read by every enemy that turn
+    mutable FlowField flowFields[static_cast<size_t>(FlowGoal::Count)];
+    mutable std::vector<std::pair<int, int>> flowGoalScratch;
+    
+    // CHANGE: 2026-10-16 - Reusable A*/JPS search state for point-to-point queries
+    mutable Pathfinder pathfinder;
+    
+    // CHANGE: 2026-10-16 - Regions of walkable tiles, kept current by updateWalkBit(); a
+    // closed tile that may split a region is relabelled lazily on the next query
+    mutable ConnectivityIndex connectivity;
+    
+    // CHANGE: 2026-10-16 - The player's sight and memory of this floor
+    mutable FieldOfView fieldOfView;
+    
+    RandomStream layoutRng;  // Stream of the floor being generated
+    
     sf::Texture floorTexture;
     sf::Texture wallTexture;
     
-    void generateRooms(int numRooms);
-    void connectRooms();
-    void fillGrid();
+    void buildLayout(std::unique_ptr<DungeonGenerator>& layout, int numRooms, int width, int height);
+    bool stairsReachable() const;
+    void connectRooms(const std::vector<RoomLink>& links);
+    void fillGrid(const std::vector<RoomLink>& links, bool carveCorridors);
     void carveHorizontalCorridor(const Room& r1, const Room& r2);
     void carveVerticalCorridor(const Room& r1, const Room& r2);
+    void addDoor(int x, int y, int roomA, int roomB);
+    void ensureRouteTable() const;
+    void buildEntranceRoutes();
+    const RouteTree& routesFrom(int fromIndex) const;  // Dense room index
+    
+    TileType tileAt(int x, int y) const { return static_cast<TileType>(tileMap.get(x, y)); }
+    void putTile(int x, int y, TileType type) { tileMap.set(x, y, static_cast<uint8_t>(type)); }
+    bool computeWalkable(int x, int y) const;
+    void updateWalkBit(int x, int y);
+    void rebuildWalkMask();
 
 public:
+    static constexpr int DEFAULT_WIDTH = 25;   // One 800x600 screen of 32px tiles
+    static constexpr int DEFAULT_HEIGHT = 18;
+    
     Dungeon();
     
-    void generate(int numRooms = 8);
+    // Same stream (see Random::stream) and parameters give the same floor.
+    // 'generator' names a DungeonGenerator layout ("classic", "bsp", "scatter", "cave").
+    void generate(RandomStream rng, int numRooms = 8, int width = DEFAULT_WIDTH, int height = DEFAULT_HEIGHT,
+                  const std::string& generator = "classic");
+    
+    // CHANGE: 2026-10-17 - Take over a saved floor (tiles, rooms, graph, doors, stairs) from
+    // a validated snapshot instead of generating one. False if the snapshot isn't open.
+    bool restore(const FloorSnapshot& snapshot);
     
     TileType getTile(int x, int y) const;
     void setTile(int x, int y, TileType type);
     
-    bool isWalkable(int x, int y) const;
+    // One bit test; false outside the map
+    bool isWalkable(int x, int y) const {
+        return tileMap.inBounds(x, y) && tileMap.walkable(x, y);
+    }
+    bool inBounds(int x, int y) const { return tileMap.inBounds(x, y); }
+    
+    // Raw chunk layers for pathfinding, rendering and the minimap
+    const ChunkedTileMap& getTileMap() const { return tileMap; }
+    unsigned int getLayoutVersion() const { return layoutVersion; }
+    unsigned int getFloorId() const { return floorId; }
+    
+    // Distance map toward the given goal tiles (cached per goal set)
+    const FlowField& getFlowField(FlowGoal goal, const std::vector<std::pair<int, int>>& goalTiles) const;
+    const FlowField& getFlowField(FlowGoal goal, int goalX, int goalY) const;
+    
+    // Single point-to-point queries (one enemy, one target). Whole-turn enemy movement
+    // should read getFlowField() instead.
+    bool findPath(int fromX, int fromY, int toX, int toY, std::vector<std::pair<int, int>>& path,
+                  Pathfinder::Method method = Pathfinder::Method::JumpPoint) const;
     std::pair<int, int> findNextMoveToPlayer(int enemyX, int enemyY, int playerX, int playerY) const;
     
+    // Same walkable region (4-connected, current door state); no path search. O(1) apart
+    // from a binary search over one row's runs.
+    bool isReachable(int fromX, int fromY, int toX, int toY) const;
+    int getRegionAt(int x, int y) const;  // -1 when the tile is not walkable
+    
+    // CHANGE: 2026-10-16 - Sight from (x, y): walls, void and closed doors block it.
+    // Recomputed only when the origin, radius or layout (doors included) changed.
+    const FieldOfView& updateFieldOfView(int x, int y, int radius) const;
+    const FieldOfView& getFieldOfView() const { return fieldOfView; }
+    
     std::vector<int> getReachableRooms(int roomId);
-    std::vector<int> findShortestPath(int fromRoom, int toRoom);
+    std::vector<int> findShortestPath(int fromRoom, int toRoom) const;
+    
+    // Routes from the entrance tree, the all-pairs table (small floors) or a cached search
+    int getRoomDistance(int fromRoom, int toRoom) const;    // INT_MAX when unreachable
+    int getNextRoomOnPath(int fromRoom, int toRoom) const;  // -1 when unreachable
     
     void visualizeBFS(int startRoom);
     void visualizeDFS(int startRoom);
     void visualizeDijkstra(int startRoom);
     
     void render(sf::RenderWindow& window, float tileSize, int currentFloor = 1) const;
+    // Darkens what the player can't see now and blacks out what they never saw (drawn over
+    // the entities; a no-op until updateFieldOfView() has run on this floor)
+    void renderFog(sf::RenderWindow& window, float tileSize) const;
     
-    int getWidth() const { return GRID_WIDTH; }
-    int getHeight() const { return GRID_HEIGHT; }
+    int getWidth() const { return tileMap.width(); }
+    int getHeight() const { return tileMap.height(); }
     
-    const Graph<int>& getGraph() const { return roomGraph; }
+    const Graph<int, CountingTrace>& getGraph() const { return roomGraph; }
     const std::vector<Room>& getRooms() const { return rooms; }
+    int getStartRoomId() const { return startRoomId; }
+    int getStairsRoomId() const { return stairsRoomId; }
     
     // TASK D: Stairs access for floor transitions
     int getStairsX() const { return stairsX; }
@@ -110,12 +234,18 @@ public:
     
     // CHANGE: 2025-11-11 - Door management
     const std::vector<DoorData>& getDoors() const { return doors; }
-    DoorData* getDoorAt(int x, int y);
+    DoorData* getDoorAt(int x, int y);              // nullptr when there is no door (O(1))
+    const DoorData* getDoorAt(int x, int y) const;
     void openDoor(int x, int y);
     void closeDoor(int x, int y);
     bool canPassDoor(int x, int y) const;
     void checkRoomClear(int roomId, int enemyCount);
     
+    // Open every openOnClear door on the floor (floor cleared); returns how many opened.
+    // Only the first call per floor walks the door list.
+    int openClearableDoors();
+    bool haveClearableDoorsOpened() const { return clearDoorsOpened; }
+    
     // CHANGE: 2025-11-14 - Door spawning support
     void spawnDoors();  // Spawn doors during level generation
     void clearDoors();  // Clear all doors for floor reset
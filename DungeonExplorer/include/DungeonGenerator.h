@@ -0,0 +1,155 @@
+// CHANGE: 2026-10-16 - Pluggable floor layout pipeline
+// A generator is two (or three) stages:
+// - TerrainStage (optional) shapes open ground first, e.g. caves
+// - RoomPlacer decides where the rooms go
+// - RoomConnector decides which pairs of rooms get a corridor
+// Dungeon::generate() then adds exactly those links to the room graph and carves a corridor
+// (with doors) for each one unless the terrain already joins the rooms, so the graph,
+// corridors and doors always agree.
+//
+// Built-in generators (selected per floor by "generator" in levels.json):
+//   "classic" - the original random placement (rooms may overlap), rooms chained in order
+//               plus a few random extra links
+//   "bsp"     - binary space partition, one room per leaf; Delaunay + MST + a few loops
+//   "scatter" - rejection-sampled rooms with a spatial hash for overlap tests; Delaunay + MST + loops
+//   "cave"    - cellular-automata cave (CaveGenerator), rooms scattered on its open ground and
+//               linked like "scatter"; the cave already joins them, so no corridors are carved
+
+#pragma once
+#include <vector>
+#include <memory>
+#include <string>
+#include <string_view>
+#include "Random.h"
+#include "ChunkedTileMap.h"
+
+struct Room;
+
+struct GenerationParams {
+    int numRooms;
+    int width;    // Map size in tiles; rooms stay inside the 1-tile border
+    int height;
+};
+
+// A corridor between two rooms (indices into the room list, which equal the room ids)
+struct RoomLink {
+    int a;
+    int b;
+};
+
+class TerrainStage {
+public:
+    virtual ~TerrainStage() = default;
+
+    // 'map' is solid wall on entry; open ground is written as Floor tiles
+    virtual void carve(const GenerationParams& params, RandomStream& rng, ChunkedTileMap& map) const = 0;
+
+    // True if all open ground written by carve() is one connected region
+    virtual bool connectsOpenGround() const { return false; }
+};
+
+class RoomPlacer {
+public:
+    virtual ~RoomPlacer() = default;
+
+    // Append up to params.numRooms rooms with ids 0, 1, 2, ... ('rooms' is cleared first).
+    // 'terrain' is the map after the terrain stage (all wall when there is none).
+    virtual void place(const GenerationParams& params, RandomStream& rng, const ChunkedTileMap& terrain,
+                       std::vector<Room>& rooms) const = 0;
+};
+
+class RoomConnector {
+public:
+    virtual ~RoomConnector() = default;
+
+    // Links that connect every room ('links' is cleared first)
+    virtual void connect(const std::vector<Room>& rooms, RandomStream& rng, std::vector<RoomLink>& links) const = 0;
+};
+
+class DungeonGenerator {
+public:
+    DungeonGenerator(std::string name, std::unique_ptr<RoomPlacer> placer, std::unique_ptr<RoomConnector> connector,
+                     std::unique_ptr<TerrainStage> terrain = nullptr);
+
+    // One of the built-in generators above; nullptr for an unknown name
+    static std::unique_ptr<DungeonGenerator> create(std::string_view name);
+
+    // 'map' must be solid wall; only the terrain stage writes to it
+    void generate(const GenerationParams& params, RandomStream& rng, ChunkedTileMap& map,
+                  std::vector<Room>& rooms, std::vector<RoomLink>& links) const;
+
+    const std::string& getName() const { return name; }
+
+    // False when the terrain already joins every room, so links need no corridor
+    bool carvesCorridors() const { return !terrain || !terrain->connectsOpenGround(); }
+
+private:
+    std::string name;
+    std::unique_ptr<RoomPlacer> placer;
+    std::unique_ptr<RoomConnector> connector;
+    std::unique_ptr<TerrainStage> terrain;
+};
+
+// --- Terrain stages ---
+
+// Cellular-automata cave (see CaveGenerator.h); only its largest region is kept
+class CaveTerrain : public TerrainStage {
+public:
+    explicit CaveTerrain(int smoothingPasses = 4) : smoothingPasses(smoothingPasses) {}
+    void carve(const GenerationParams& params, RandomStream& rng, ChunkedTileMap& map) const override;
+    bool connectsOpenGround() const override { return true; }
+
+private:
+    int smoothingPasses;
+};
+
+// --- Room placers ---
+
+// Original layout: independent random rectangles, overlaps allowed
+class ClassicPlacer : public RoomPlacer {
+public:
+    void place(const GenerationParams& params, RandomStream& rng, const ChunkedTileMap& terrain,
+               std::vector<Room>& rooms) const override;
+};
+
+// Split the largest region until there is one region per room, then put a room in each.
+// Rooms never overlap or touch.
+class BspPlacer : public RoomPlacer {
+public:
+    void place(const GenerationParams& params, RandomStream& rng, const ChunkedTileMap& terrain,
+               std::vector<Room>& rooms) const override;
+};
+
+// Random rectangles, rejected when they overlap (or touch) a placed room. Candidates are
+// only tested against rooms in the same spatial-hash cells, so placement stays linear.
+// With onOpenGround, rooms must also lie entirely on open terrain (e.g. inside a cave).
+class ScatterPlacer : public RoomPlacer {
+public:
+    explicit ScatterPlacer(bool onOpenGround = false, int attemptsPerRoom = 30)
+        : onOpenGround(onOpenGround), attemptsPerRoom(attemptsPerRoom) {}
+    void place(const GenerationParams& params, RandomStream& rng, const ChunkedTileMap& terrain,
+               std::vector<Room>& rooms) const override;
+
+private:
+    bool onOpenGround;
+    int attemptsPerRoom;
+};
+
+// --- Room connectors ---
+
+// Room i to room i + 1, plus rooms / 2 random extra links (the original layout)
+class ChainConnector : public RoomConnector {
+public:
+    void connect(const std::vector<Room>& rooms, RandomStream& rng, std::vector<RoomLink>& links) const override;
+};
+
+// Delaunay triangulation of the room centres, its minimum spanning tree (Kruskal), and
+// loopPercent% of the remaining Delaunay edges added back so the floor is not a pure tree
+class DelaunayMstConnector : public RoomConnector {
+public:
+    explicit DelaunayMstConnector(int loopPercent = 15) : loopPercent(loopPercent) {}
+    void connect(const std::vector<Room>& rooms, RandomStream& rng, std::vector<RoomLink>& links) const override;
+
+private:
+    int loopPercent;
+};
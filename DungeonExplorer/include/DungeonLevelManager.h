@@ -16,6 +16,9 @@ struct LevelData {
     std::string theme;
     std::string description;
     int roomCount;
+    int mapWidth;    // Tiles, from levels.json; defaults match Dungeon::DEFAULT_WIDTH/HEIGHT (one screen)
+    int mapHeight;
+    std::string generator;  // DungeonGenerator layout name ("classic", "bsp", "scatter", "cave")
     std::vector<std::string> enemyTypes;
     int enemyCount;
     float difficulty;
@@ -27,13 +30,14 @@ struct LevelData {
     bool boss;
     std::string bossName;
     
-    LevelData() : floor(1), roomCount(7), enemyCount(3), difficulty(1.0f), 
+    LevelData() : floor(1), roomCount(7), mapWidth(25), mapHeight(18), generator("classic"), enemyCount(3), difficulty(1.0f), 
                   ambientLevel(0.5f), boss(false) {}
 };
 
 class Dungeon;
 class EnemyManager;
 class Player;
+class Loot;
 
 class DungeonLevelManager {
 private:
@@ -41,6 +45,7 @@ private:
     int currentFloor;
     int maxFloors;
     bool levelsLoaded;
+    std::string floorCacheDirectory;  // Where visited floors are kept (FloorSnapshot files)
     
     // Difficulty scaling formulas
     int calculateEnemyHP(int baseHP, int floor) const;
@@ -60,8 +65,23 @@ public:
     // Floor management
     bool advanceFloor();
     void generateLevel(int floor, Dungeon& dungeon, EnemyManager& enemies, Player& player);
+    // CHANGE: 2026-10-16 - Layout + spawns only; reads nothing but the loaded level table,
+    // so FloorPreloader can run it on a worker thread while the current floor is played
+    void buildLevel(int floor, Dungeon& dungeon, EnemyManager& enemies) const;
     void resetToFloor(int floor);
     
+    // CHANGE: 2026-10-17 - Floors on disk, one snapshot per (run seed, floor).
+    // restoreFloor() maps the file and rebuilds the floor as it was saved; false when this
+    // run has no valid snapshot of it (the caller generates the floor instead).
+    // dungeon_gen_bench saves and reloads fixed floors with these; the game only descends,
+    // so it keeps no floors until something revisits them.
+    void setFloorCacheDirectory(const std::string& directory) { floorCacheDirectory = directory; }
+    std::string getFloorSnapshotPath(int floor) const;
+    bool saveFloor(int floor, const Dungeon& dungeon, const EnemyManager& enemies, const std::vector<Loot>& loots) const;
+    bool hasSavedFloor(int floor) const;
+    bool restoreFloor(int floor, Dungeon& dungeon, EnemyManager& enemies, std::vector<Loot>& loots) const;
+    void clearSavedFloors() const;  // Drop this run's snapshots (a new run may reuse the seed)
+    
     // Getters
     int getCurrentFloor() const { return currentFloor; }
     int getMaxFloors() const { return maxFloors; }
@@ -72,7 +92,7 @@ public:
     float getDifficultyMultiplier() const;
     
     // Enemy spawning
-    void spawnFloorEnemies(EnemyManager& enemies, Dungeon& dungeon, int floor);
+    void spawnFloorEnemies(EnemyManager& enemies, const Dungeon& dungeon, int floor) const;
     std::string getRandomEnemyType(int floor) const;
     
     // Skill unlocks
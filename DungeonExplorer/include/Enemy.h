@@ -8,6 +8,9 @@
 #include <vector>
 #include <nlohmann/json.hpp>
 #include "DataStructures/Queue.h"
+#include "Position.h"
+
+class FieldOfView;
 
 struct EnemyData {
     int id;
@@ -48,6 +51,8 @@ public:
                              const nlohmann::json& dropTable);  // NEW: Spawn with drop table
     void removeEnemy(int id);
     void removeDeadEnemies();  // Remove all enemies with health <= 0
+    // CHANGE: 2026-10-17 - Replace every enemy with a saved set (FloorSnapshot); ids are kept
+    void restore(std::vector<EnemyData> saved);
     
     void initializeTurnQueue();
     EnemyData* getNextEnemy();
@@ -58,7 +63,10 @@ public:
     void setEnemyAILevel(EnemyData& enemy, int floor);
     
     void update(float deltaTime);
-    void render(sf::RenderWindow& window, float tileSize) const;
+    // CHANGE: 2026-10-16 - Only enemies inside 'visible' (the camera's tiles) are drawn,
+    // and with a FieldOfView only those on a tile the player can currently see
+    void render(sf::RenderWindow& window, float tileSize, const TileRect& visible,
+                const FieldOfView* sight = nullptr) const;
     
     const std::vector<EnemyData>& getEnemies() const { return enemies; }
     EnemyData* findNearestEnemy(int playerX, int playerY);
@@ -0,0 +1,83 @@
+// CHANGE: 2026-10-16 - Player sight: symmetric shadowcasting over the tile grid
+// Each of the four quadrants is scanned row by row outward from the origin; walls narrow
+// the visible slope range of the rows behind them. Slopes are exact fractions, and a
+// floor tile is only lit if its centre lies inside the range, which makes sight symmetric:
+// if A can see B, B can see A (so "the player sees the enemy" is also "the enemy sees the player").
+// - Visible and explored tiles are bit layers, 64 tiles per word, one row after another
+// - A recompute only clears the words the previous one could have set (radius box)
+// - No allocation per compute once the layers and the row stack have grown
+// Walls that bound a lit area are lit themselves, so rooms show their outline.
+
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+class ChunkedTileMap;
+
+class FieldOfView {
+public:
+    FieldOfView();
+
+    // Size the layers for a width x height map and forget everything seen (new floor)
+    void reset(int width, int height);
+
+    // Recompute from (originX, originY). A tile byte t blocks sight when bit t of
+    // opaqueTiles is set; outside the map blocks sight too.
+    void compute(const ChunkedTileMap& map, int originX, int originY, int radius,
+                 uint32_t opaqueTiles, unsigned int layoutVersion);
+
+    // True if the last compute() had this origin and radius on this layout
+    bool isCurrent(int originX, int originY, int radius, unsigned int layoutVersion) const {
+        return computed && originX == lastX && originY == lastY && radius == lastRadius && layoutVersion == version;
+    }
+    bool isComputed() const { return computed; }  // False until the first compute() after reset()
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+
+    bool isVisible(int x, int y) const { return testBit(visible, x, y); }
+    bool isExplored(int x, int y) const { return testBit(explored, x, y); }
+
+    // Explored bits of tiles [x & ~63, (x & ~63) + 64) of row y (0 outside the map)
+    uint64_t exploredWord(int x, int y) const {
+        return inBounds(x, y) ? explored[static_cast<size_t>(y) * wordsPerRow + (x >> 6)] : 0;
+    }
+
+    // Bumped whenever a compute() explores a tile for the first time
+    unsigned int getExploredVersion() const { return exploredVersion; }
+    size_t getVisibleCount() const { return visibleCount; }
+
+private:
+    // One row of a quadrant scan: tiles at 'depth' between two slopes (num / den, den > 0)
+    struct Row {
+        int depth;
+        int startNum, startDen;
+        int endNum, endDen;
+    };
+
+    int width;
+    int height;
+    int wordsPerRow;
+    std::vector<uint64_t> visible;
+    std::vector<uint64_t> explored;
+    std::vector<Row> rowStack;  // Pending rows of the current quadrant, reused
+
+    bool computed;
+    int lastX, lastY, lastRadius;
+    unsigned int version;
+    unsigned int exploredVersion;
+    size_t visibleCount;
+    int boxX0, boxY0, boxX1, boxY1;  // Tiles the last compute() may have lit (inclusive)
+
+    bool inBounds(int x, int y) const {
+        return static_cast<unsigned>(x) < static_cast<unsigned>(width) &&
+               static_cast<unsigned>(y) < static_cast<unsigned>(height);
+    }
+    bool testBit(const std::vector<uint64_t>& layer, int x, int y) const {
+        return inBounds(x, y) && ((layer[static_cast<size_t>(y) * wordsPerRow + (x >> 6)] >> (x & 63)) & 1);
+    }
+
+    void clearBox();
+    void scanQuadrant(const ChunkedTileMap& map, int quadrant, int originX, int originY, int radius, uint32_t opaqueTiles);
+    void reveal(int x, int y);
+};
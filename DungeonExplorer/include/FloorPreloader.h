@@ -0,0 +1,58 @@
+// CHANGE: 2026-10-16 - Builds floor N+1 on a worker thread while floor N is played
+// request(floor) starts a worker that builds a fresh Dungeon + EnemyManager; take(floor)
+// hands them over, so descending is a pointer swap. If the build is still running when
+// the player reaches the stairs, take() waits for it (the old synchronous cost, at worst).
+// The worker only touches its own Dungeon/EnemyManager and the read-only level table.
+// CHANGE: 2026-10-17 - The finished floor comes back through an SpscQueue (worker produces,
+// the main thread consumes), so checking for it each frame takes no lock
+
+#pragma once
+#include <exception>
+#include <memory>
+#include <thread>
+#include "SpscQueue.h"
+
+class Dungeon;
+class EnemyManager;
+class DungeonLevelManager;
+
+struct PreparedFloor {
+    int floor;
+    std::unique_ptr<Dungeon> dungeon;      // Generated: rooms, room graph, doors, stairs
+    std::unique_ptr<EnemyManager> enemies; // Spawned for this floor
+    std::exception_ptr error;              // Set if the build threw (dungeon/enemies may be null); take() rethrows it
+    
+    PreparedFloor(int floor);
+    ~PreparedFloor();
+};
+
+class FloorPreloader {
+private:
+    const DungeonLevelManager& levels;
+    std::thread worker;
+    SpscQueue<std::unique_ptr<PreparedFloor>> finished;  // Worker -> main thread
+    std::unique_ptr<PreparedFloor> ready;                // Taken off the queue, not handed out yet
+    int pendingFloor;
+    
+    // Main thread: move a finished build off the queue into 'ready'
+    void collect();
+    
+public:
+    explicit FloorPreloader(const DungeonLevelManager& levels);
+    ~FloorPreloader();  // Waits for a running build
+    
+    FloorPreloader(const FloorPreloader&) = delete;
+    FloorPreloader& operator=(const FloorPreloader&) = delete;
+    
+    // Start building 'floor' in the background (replaces any other pending floor)
+    void request(int floor);
+    
+    // True once the pending build has finished
+    bool isReady();
+    
+    // Prepared floor, waiting for the build if needed; nullptr if 'floor' was never requested
+    std::unique_ptr<PreparedFloor> take(int floor);
+    
+    // Drop any pending build (waits for it to stop)
+    void cancel();
+};
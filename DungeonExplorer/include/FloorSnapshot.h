@@ -0,0 +1,187 @@
+// CHANGE: 2026-10-17 - Binary floor snapshots (.dxf), mapped and read in place
+// A floor is saved as one little-endian file: a fixed header, then eight sections of
+// plain records, each 8-byte aligned and covered by its own CRC-32:
+//   Chunks     one uint32 per 64x64 chunk of the map: index into ChunkData, or NO_CHUNK (solid fill)
+//   ChunkData  ChunkedTileMap::Chunk as it sits in memory (tile bytes + walk words)
+//   Rooms, Edges (room graph, each undirected edge once), Doors
+//   Spawns     live enemies, Loot  items on the ground
+//   Strings    names, types and JSON blobs that Spawns/Loot point into (offset, length)
+// open() maps the file (a plain read where mmap is unavailable), checks the header, every
+// section CRC and every string reference, then hands out pointers straight into the
+// mapping; restore() copies chunks with one memcpy each, so a floor comes back without
+// generating, carving or parsing anything.
+// The format is little-endian; hosts of the other byte order refuse to read or write it.
+
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "ChunkedTileMap.h"
+
+class Dungeon;
+class EnemyManager;
+class Loot;
+
+namespace Snapshot {
+    constexpr uint32_t MAGIC = 0x53465844;  // "DXFS"
+    constexpr uint16_t VERSION = 1;
+    constexpr uint32_t NO_CHUNK = 0xFFFFFFFFu;
+    constexpr uint8_t FLAG_CLEAR_DOORS_OPENED = 1;  // Dungeon::openClearableDoors() already ran
+
+    enum Section : uint32_t {
+        Chunks,
+        ChunkData,
+        Rooms,
+        Edges,
+        Doors,
+        Spawns,
+        Loot,
+        Strings,
+        SectionCount
+    };
+
+    struct SectionEntry {
+        uint32_t offset;  // From the start of the file, multiple of 8
+        uint32_t count;   // Records
+        uint32_t bytes;   // count * record size
+        uint32_t crc;     // CRC-32 of the section bytes
+    };
+
+    struct Header {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t headerBytes;  // sizeof(Header)
+        uint64_t runSeed;      // Random seed of the run that saved the floor
+        int32_t floor;
+        int32_t width;
+        int32_t height;
+        uint8_t fillTile;      // What unallocated chunks read as
+        uint8_t flags;         // FLAG_*
+        uint8_t reserved[2];
+        int32_t startRoomId;
+        int32_t stairsRoomId;
+        int32_t stairsX;
+        int32_t stairsY;
+        SectionEntry sections[SectionCount];
+        uint32_t headerCrc;    // CRC-32 of every header byte before this field
+        uint32_t reserved2;
+    };
+
+    // A piece of the Strings section
+    struct Text {
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    struct Room {
+        int32_t id, x, y, width, height;
+        uint8_t type;     // TileType
+        uint8_t cleared;
+        uint8_t reserved[2];
+    };
+
+    struct Edge {
+        int32_t roomA, roomB;  // Room ids
+        int32_t weight;
+    };
+
+    struct Door {
+        int32_t x, y;
+        int32_t roomA, roomB;
+        uint8_t isOpen;
+        uint8_t requiresKey;
+        uint8_t openOnClear;
+        uint8_t reserved;
+    };
+
+    struct Spawn {
+        int32_t id;
+        int32_t health, maxHealth, damage;
+        int32_t x, y;
+        int32_t attackRange;
+        float moveSpeed;
+        int32_t aiLevel;
+        int32_t floorLevel;
+        Text name, type;
+        Text dropTable;   // JSON text
+    };
+
+    struct LootItem {
+        int32_t x, y;
+        int32_t rarity, value;
+        float cooldown;
+        Text id, name, type, iconPath;
+        Text actionKind;
+        Text actionParams;  // JSON text
+    };
+}
+
+class FloorSnapshot {
+public:
+    // Contiguous records inside the mapping
+    template<typename T>
+    struct View {
+        const T* data = nullptr;
+        size_t count = 0;
+
+        const T* begin() const { return data; }
+        const T* end() const { return data + count; }
+        size_t size() const { return count; }
+        const T& operator[](size_t i) const { return data[i]; }
+    };
+
+    FloorSnapshot() = default;
+    ~FloorSnapshot();
+    FloorSnapshot(const FloorSnapshot&) = delete;
+    FloorSnapshot& operator=(const FloorSnapshot&) = delete;
+
+    // Save a floor to 'path' (written next to it, then renamed over it). False on I/O errors.
+    static bool write(const std::string& path, int floor, uint64_t runSeed, const Dungeon& dungeon,
+                      const EnemyManager& enemies, const std::vector<Loot>& loots);
+
+    // Map and validate a snapshot. False (with a log line) if it is missing, truncated,
+    // of another version or fails a checksum; the previous mapping is released either way.
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return header != nullptr; }
+
+    const Snapshot::Header& getHeader() const { return *header; }
+    size_t getFileBytes() const { return fileBytes; }
+
+    // nullptr for chunks that are solid fill
+    const ChunkedTileMap::Chunk* chunkAt(int chunkX, int chunkY) const;
+    int chunkCountX() const { return chunksX; }
+    int chunkCountY() const { return chunksY; }
+
+    View<Snapshot::Room> rooms() const { return view<Snapshot::Room>(Snapshot::Rooms); }
+    View<Snapshot::Edge> edges() const { return view<Snapshot::Edge>(Snapshot::Edges); }
+    View<Snapshot::Door> doors() const { return view<Snapshot::Door>(Snapshot::Doors); }
+    View<Snapshot::Spawn> spawns() const { return view<Snapshot::Spawn>(Snapshot::Spawns); }
+    View<Snapshot::LootItem> loot() const { return view<Snapshot::LootItem>(Snapshot::Loot); }
+    std::string_view text(Snapshot::Text ref) const;
+
+    // Replace the live floor with this one: tiles, rooms, doors, enemies and loot
+    bool restore(Dungeon& dungeon, EnemyManager& enemies, std::vector<Loot>& loots) const;
+
+    static uint32_t crc32(const void* data, size_t bytes);
+
+private:
+    const Snapshot::Header* header = nullptr;
+    const unsigned char* base = nullptr;
+    size_t fileBytes = 0;
+    int chunksX = 0;
+    int chunksY = 0;
+    bool mapped = false;              // base is an mmap (else it points into 'buffer')
+    std::vector<uint64_t> buffer;     // Fallback copy, 8-byte aligned like a mapping
+
+    template<typename T>
+    View<T> view(Snapshot::Section section) const {
+        const Snapshot::SectionEntry& entry = header->sections[section];
+        return View<T>{reinterpret_cast<const T*>(base + entry.offset), entry.count};
+    }
+
+    bool validate(const std::string& path);
+    bool textInRange(Snapshot::Text ref) const;
+};
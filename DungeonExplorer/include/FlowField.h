@@ -0,0 +1,59 @@
+// CHANGE: 2026-10-16 - Multi-source distance map ("flow field") toward a set of goal tiles
+// One BFS from all goals at once gives every tile its step count to the nearest goal.
+// Any number of agents then pick their next step in O(1) by reading their 4 neighbours,
+// instead of each agent running its own search.
+//
+// Distances are stored per 64x64 chunk of the ChunkedTileMap they were computed on;
+// unallocated (solid) chunks get no storage and read as UNREACHABLE.
+
+#pragma once
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include "ChunkedTileMap.h"
+
+class FlowField {
+public:
+    static constexpr uint32_t UNREACHABLE = UINT32_MAX;
+
+    FlowField();
+
+    // Rebuild from the map's walk bits. Goals are seeded at distance 0 even when their
+    // own tile is not walkable (e.g. the player standing in a doorway).
+    void compute(const ChunkedTileMap& map, const std::vector<std::pair<int, int>>& goals,
+                 unsigned int layoutVersion);
+
+    // True if the last compute() used these goals on this layout
+    bool isCurrent(const std::vector<std::pair<int, int>>& goals, unsigned int layoutVersion) const {
+        return built && version == layoutVersion && goalTiles == goals;
+    }
+
+    uint32_t distanceAt(int x, int y) const;
+    bool isReachable(int x, int y) const { return distanceAt(x, y) != UNREACHABLE; }
+
+    // Neighbour (up, down, left, right order on ties) that is strictly closer to a goal;
+    // {x, y} when none is
+    std::pair<int, int> stepToward(int x, int y) const;
+
+    // Reachable neighbour that is strictly further from every goal, for fleeing; {x, y} when none is
+    std::pair<int, int> stepAway(int x, int y) const;
+
+    const std::vector<std::pair<int, int>>& getGoals() const { return goalTiles; }
+
+private:
+    static constexpr uint32_t NO_SLOT = UINT32_MAX;
+
+    int width;
+    int height;
+    int chunksX;
+    std::vector<uint32_t> chunkSlot;   // Chunk directory index -> slot in 'distance', NO_SLOT if solid
+    std::vector<uint32_t> distance;    // CHUNK_TILES entries per slot
+    std::vector<uint32_t> frontier;    // BFS queue of packed y * width + x, reused between computes
+
+    std::vector<std::pair<int, int>> goalTiles;
+    unsigned int version;
+    bool built;
+
+    // Index into 'distance', or NO_SLOT for out-of-bounds and solid chunks
+    uint32_t cellIndex(int x, int y) const;
+};
@@ -13,6 +13,7 @@ class SkillTree;
 class DungeonLevelManager;  // 10-floor system
 class Loot;  // NEW: Loot entity for items on ground
 class Shop;  // NEW: Shop system for buying items
+class FloorPreloader;  // Background generation of the next floor
 struct ItemNew;  // NEW: Item definition
 
 // ✨ Visual Effect for combat feedback
@@ -26,17 +27,6 @@ struct CombatEffect {
         : effectType(type), x(posX), y(posY), lifetime(duration), maxLifetime(duration) {}
 };
 
-// CHANGE: 2025-11-10 - Door structure for interactive doors
-struct Door {
-    int x, y;
-    bool isOpen;
-    bool openOnClear;  // Open when room cleared
-    bool requiresKey;  // Requires key item
-    
-    Door(int posX, int posY, bool clear = false, bool key = false)
-        : x(posX), y(posY), isOpen(false), openOnClear(clear), requiresKey(key) {}
-};
-
 class Game {
 private:
     sf::RenderWindow window;
@@ -49,15 +39,17 @@ private:
     std::unique_ptr<SkillTree> skillTree;
     std::unique_ptr<DungeonLevelManager> levelManager;  // NEW: 10-floor manager
     std::unique_ptr<Shop> shop;  // NEW: Shop system
+    std::unique_ptr<FloorPreloader> floorPreloader;  // Builds floor N+1 while N is played (uses levelManager)
     
     bool isRunning;
     bool isPaused;
     int currentFloor;
     Position exitStairsPosition;
+    static constexpr int SIGHT_RADIUS = 10;  // CHANGE: 2026-10-16 - Field of view radius in tiles
     
     // CHANGE: 2025-11-10 - Loot system with items on ground
     std::vector<Loot> loots;  // Items on the ground
-    std::vector<Door> doors;  // Interactive doors
+    // Doors live in Dungeon's door layer (Dungeon::getDoorAt)
     
     // ✨ Active combat effects
     std::vector<CombatEffect> activeEffects;
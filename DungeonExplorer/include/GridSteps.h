@@ -0,0 +1,8 @@
+// CHANGE: 2026-10-17 - The 4-neighbour step table used by tile searches
+// Up, Down, Left, Right: the order of the original per-enemy BFS. The flow field and the
+// pathfinder both expand in this order, so equal-length routes break ties the same way.
+
+#pragma once
+
+constexpr int STEP_X[4] = {0, 0, -1, 1};
+constexpr int STEP_Y[4] = {-1, 1, 0, 0};
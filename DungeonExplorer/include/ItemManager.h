@@ -3,14 +3,16 @@
 
 #pragma once
 #include "ItemNew.h"
-#include <unordered_map>
+#include "DataStructures/HashTable.h"
 #include <string>
+#include <string_view>
 #include <memory>
 
 // Singleton ItemManager for global item database access
 class ItemManager {
 private:
-    std::unordered_map<std::string, ItemNew> itemDB;  // Hash Table: id -> Item
+    // CHANGE: 2026-10-16 - Open-addressing HashTable, looked up by string_view (no key allocation)
+    HashTable<std::string, ItemNew, NoTrace> itemDB;  // Hash Table: id -> Item
     static std::unique_ptr<ItemManager> instance;
     
     ItemManager() = default;
@@ -31,15 +33,15 @@ public:
     void loadItems(const std::string& path);
     
     // Get item by ID (O(1) hash table lookup)
-    ItemNew getItemById(const std::string& id) const;
+    ItemNew getItemById(std::string_view id) const;
     
     // Check if item exists
-    bool hasItem(const std::string& id) const {
-        return itemDB.find(id) != itemDB.end();
+    bool hasItem(std::string_view id) const {
+        return itemDB.contains(id);
     }
     
     // Get all items (for debugging/inventory display)
-    const std::unordered_map<std::string, ItemNew>& getAllItems() const {
+    const HashTable<std::string, ItemNew, NoTrace>& getAllItems() const {
         return itemDB;
     }
     
@@ -0,0 +1,298 @@
+// CHANGE: 2026-10-16 - Bounded, run-length encoded movement history
+// Replaces Stack<Position> for Player::pathHistory, which grew by one Position per step forever.
+//
+// Hot buffer (uint16 words, newest at the back):
+//   run word   = run length (bits 2..15, 1..16383) | direction (bits 0..1)
+//                so a straight corridor of any length is a single word
+//   jump block = ESC, dx lo, dx hi, dy lo, dy hi, ESC   (teleports, floor changes)
+//                ESC (run length 0) at both ends so the block parses in either direction
+// Cold buffer (byte segments, oldest at the front):
+//   when the hot buffer passes its cap, its older half is re-encoded to ~1 byte per run
+//   and pushed as a segment; past the cold cap the oldest segments are dropped.
+//
+// backtrack() is O(1) (amortized when it has to thaw a cold segment back into hot).
+
+#pragma once
+#include "Position.h"
+#include <vector>
+#include <deque>
+#include <cstdint>
+#include <cstddef>
+
+class MovementHistory {
+public:
+    static constexpr size_t DEFAULT_HOT_WORDS = 1024;   // 2 KB
+    static constexpr size_t DEFAULT_COLD_BYTES = 8192;  // 8 KB
+
+    explicit MovementHistory(size_t hotWords = DEFAULT_HOT_WORDS, size_t coldBytes = DEFAULT_COLD_BYTES)
+        : hotCapacity(hotWords < MIN_HOT_WORDS ? MIN_HOT_WORDS : hotWords), coldCapacity(coldBytes) {}
+
+    // Start a new history at the given position
+    void reset(Position start) {
+        oldest = start;
+        head = start;
+        hot.clear();
+        cold.clear();
+        coldBytes = 0;
+        hotSteps = 0;
+        coldSteps = 0;
+        dropped = 0;
+    }
+
+    // Record a move from current() to 'to'
+    void record(Position to) {
+        const int dx = to.x - head.x;
+        const int dy = to.y - head.y;
+        const int dir = directionOf(dx, dy);
+
+        if (dir < 0) {
+            pushJump(hot, dx, dy);
+        } else if (!hot.empty() && !isEscape(hot.back()) && directionBits(hot.back()) == dir &&
+                   runLength(hot.back()) < MAX_RUN) {
+            hot.back() += RUN_UNIT;  // Extend the current straight run
+        } else {
+            hot.push_back(makeRun(dir, 1));
+        }
+
+        head = to;
+        hotSteps++;
+        if (hot.size() > hotCapacity) spill();
+    }
+
+    // Undo the most recent move. Returns false once the oldest retained position is reached.
+    bool backtrack() {
+        if (hot.empty()) {
+            if (cold.empty()) return false;
+            thawNewestSegment();
+        }
+
+        const uint16_t last = hot.back();
+        if (isEscape(last)) {
+            const size_t n = hot.size();
+            head.x -= readInt(hot[n - 5], hot[n - 4]);
+            head.y -= readInt(hot[n - 3], hot[n - 2]);
+            hot.resize(n - JUMP_WORDS);
+        } else {
+            const int dir = directionBits(last);
+            head.x -= DX[dir];
+            head.y -= DY[dir];
+            if (runLength(last) > 1) {
+                hot.back() -= RUN_UNIT;
+            } else {
+                hot.pop_back();
+            }
+        }
+        hotSteps--;
+        return true;
+    }
+
+    // Visit positions from current() back towards the oldest retained one.
+    // f(Position) returns false to stop early. The trail visualizer only needs the
+    // first few, which always come from the hot buffer.
+    template<typename F>
+    void forEachReverse(F&& f) const {
+        Position pos = head;
+        if (!f(pos)) return;
+        if (!walkBack(hot, pos, f)) return;
+
+        std::vector<uint16_t> words;
+        for (auto it = cold.rbegin(); it != cold.rend(); ++it) {
+            words.clear();
+            decodeSegment(it->bytes, words);
+            if (!walkBack(words, pos, f)) return;
+        }
+    }
+
+    Position current() const { return head; }
+    Position oldestRetained() const { return oldest; }
+    size_t size() const { return hotSteps + coldSteps; }  // Retained steps
+    bool isEmpty() const { return size() == 0; }
+    size_t droppedSteps() const { return dropped; }
+
+    size_t memoryBytes() const {
+        size_t bytes = sizeof(*this) + hot.capacity() * sizeof(uint16_t);
+        for (const auto& segment : cold) {
+            bytes += sizeof(segment) + segment.bytes.capacity();
+        }
+        return bytes;
+    }
+
+private:
+    struct ColdSegment {
+        std::vector<uint8_t> bytes;
+        int dx, dy;    // Net displacement of the segment
+        size_t steps;
+    };
+
+    static constexpr size_t MIN_HOT_WORDS = 16;
+    static constexpr size_t JUMP_WORDS = 6;
+    static constexpr uint16_t ESC = 0;
+    static constexpr uint16_t RUN_UNIT = 1 << 2;
+    static constexpr int MAX_RUN = 0xFFFF >> 2;
+    static constexpr int DX[4] = {0, 1, 0, -1};  // N, E, S, W
+    static constexpr int DY[4] = {-1, 0, 1, 0};
+
+    // Cold byte codes
+    static constexpr uint8_t COLD_LONG_RUN = 0x80;  // | dir, then varint run
+    static constexpr uint8_t COLD_JUMP = 0xFF;      // then zigzag varint dx, dy
+    static constexpr int COLD_SHORT_MAX = 31;       // (run << 2) | dir fits below 0x80
+
+    size_t hotCapacity;
+    size_t coldCapacity;
+
+    std::vector<uint16_t> hot;
+    std::deque<ColdSegment> cold;
+    size_t coldBytes = 0;
+    size_t hotSteps = 0;
+    size_t coldSteps = 0;
+    size_t dropped = 0;
+    Position oldest;
+    Position head;
+
+    static int directionOf(int dx, int dy) {
+        for (int d = 0; d < 4; d++) {
+            if (DX[d] == dx && DY[d] == dy) return d;
+        }
+        return -1;
+    }
+
+    static bool isEscape(uint16_t word) { return (word >> 2) == 0; }
+    static int directionBits(uint16_t word) { return word & 3; }
+    static int runLength(uint16_t word) { return word >> 2; }
+    static uint16_t makeRun(int dir, int run) { return static_cast<uint16_t>((run << 2) | dir); }
+
+    static int readInt(uint16_t lo, uint16_t hi) {
+        return static_cast<int>(static_cast<uint32_t>(lo) | (static_cast<uint32_t>(hi) << 16));
+    }
+
+    static void pushJump(std::vector<uint16_t>& words, int dx, int dy) {
+        const uint32_t ux = static_cast<uint32_t>(dx);
+        const uint32_t uy = static_cast<uint32_t>(dy);
+        words.push_back(ESC);
+        words.push_back(static_cast<uint16_t>(ux & 0xFFFF));
+        words.push_back(static_cast<uint16_t>(ux >> 16));
+        words.push_back(static_cast<uint16_t>(uy & 0xFFFF));
+        words.push_back(static_cast<uint16_t>(uy >> 16));
+        words.push_back(ESC);
+    }
+
+    template<typename F>
+    static bool walkBack(const std::vector<uint16_t>& words, Position& pos, F& f) {
+        size_t i = words.size();
+        while (i > 0) {
+            const uint16_t word = words[i - 1];
+            if (isEscape(word)) {
+                pos.x -= readInt(words[i - 5], words[i - 4]);
+                pos.y -= readInt(words[i - 3], words[i - 2]);
+                i -= JUMP_WORDS;
+                if (!f(pos)) return false;
+            } else {
+                const int dir = directionBits(word);
+                for (int k = runLength(word); k > 0; k--) {
+                    pos.x -= DX[dir];
+                    pos.y -= DY[dir];
+                    if (!f(pos)) return false;
+                }
+                i--;
+            }
+        }
+        return true;
+    }
+
+    static void writeVarint(std::vector<uint8_t>& out, uint32_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<uint8_t>(value));
+    }
+
+    static uint32_t readVarint(const std::vector<uint8_t>& in, size_t& i) {
+        uint32_t value = 0;
+        for (int shift = 0; ; shift += 7) {
+            const uint8_t byte = in[i++];
+            value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) return value;
+        }
+    }
+
+    static uint32_t zigzag(int v) { return (static_cast<uint32_t>(v) << 1) ^ static_cast<uint32_t>(v >> 31); }
+    static int unzigzag(uint32_t v) { return static_cast<int>(v >> 1) ^ -static_cast<int>(v & 1); }
+
+    static void decodeSegment(const std::vector<uint8_t>& bytes, std::vector<uint16_t>& words) {
+        size_t i = 0;
+        while (i < bytes.size()) {
+            const uint8_t code = bytes[i++];
+            if (code == COLD_JUMP) {
+                const int dx = unzigzag(readVarint(bytes, i));
+                const int dy = unzigzag(readVarint(bytes, i));
+                pushJump(words, dx, dy);
+            } else if (code & COLD_LONG_RUN) {
+                words.push_back(makeRun(code & 3, static_cast<int>(readVarint(bytes, i))));
+            } else {
+                words.push_back(makeRun(code & 3, code >> 2));
+            }
+        }
+    }
+
+    // Move the older half of the hot buffer into a new cold segment
+    void spill() {
+        ColdSegment segment{{}, 0, 0, 0};
+        size_t i = 0;
+        while (i < hot.size() / 2) {
+            const uint16_t word = hot[i];
+            if (isEscape(word)) {
+                const int dx = readInt(hot[i + 1], hot[i + 2]);
+                const int dy = readInt(hot[i + 3], hot[i + 4]);
+                segment.bytes.push_back(COLD_JUMP);
+                writeVarint(segment.bytes, zigzag(dx));
+                writeVarint(segment.bytes, zigzag(dy));
+                segment.dx += dx;
+                segment.dy += dy;
+                segment.steps++;
+                i += JUMP_WORDS;
+            } else {
+                const int dir = directionBits(word);
+                const int run = runLength(word);
+                if (run <= COLD_SHORT_MAX) {
+                    segment.bytes.push_back(static_cast<uint8_t>((run << 2) | dir));
+                } else {
+                    segment.bytes.push_back(static_cast<uint8_t>(COLD_LONG_RUN | dir));
+                    writeVarint(segment.bytes, static_cast<uint32_t>(run));
+                }
+                segment.dx += DX[dir] * run;
+                segment.dy += DY[dir] * run;
+                segment.steps += run;
+                i++;
+            }
+        }
+
+        hot.erase(hot.begin(), hot.begin() + static_cast<std::ptrdiff_t>(i));
+        hotSteps -= segment.steps;
+        coldSteps += segment.steps;
+        coldBytes += segment.bytes.size();
+        segment.bytes.shrink_to_fit();
+        cold.push_back(std::move(segment));
+
+        // Past the cold cap, forget the oldest moves
+        while (coldBytes > coldCapacity && !cold.empty()) {
+            const ColdSegment& old = cold.front();
+            oldest.x += old.dx;
+            oldest.y += old.dy;
+            dropped += old.steps;
+            coldSteps -= old.steps;
+            coldBytes -= old.bytes.size();
+            cold.pop_front();
+        }
+    }
+
+    // Hot is empty: bring the newest cold segment back so backtracking can continue
+    void thawNewestSegment() {
+        ColdSegment& segment = cold.back();
+        decodeSegment(segment.bytes, hot);
+        hotSteps += segment.steps;
+        coldSteps -= segment.steps;
+        coldBytes -= segment.bytes.size();
+        cold.pop_back();
+    }
+};
@@ -0,0 +1,85 @@
+// CHANGE: 2026-10-16 - Point-to-point grid search without per-query allocations
+// - Per-tile search state lives in buffers indexed by tile id (grouped per 64x64 chunk,
+//   like FlowField) and is reused by every query. A generation stamp marks which entries
+//   belong to the current query, so nothing is cleared between searches.
+// - The open list is a RadixHeap: with the Manhattan heuristic on a 4-connected grid,
+//   f never decreases during a search, which is exactly the radix heap's requirement.
+// - A* expands one tile at a time. Jump Point Search (4-connected variant) skips across
+//   open rooms and only stops where the wall layout could make another route shorter.
+// After the first few queries have sized the buffers, searches do not allocate.
+
+#pragma once
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+#include "ChunkedTileMap.h"
+#include "DataStructures/RadixHeap.h"
+
+class Pathfinder {
+public:
+    enum class Method {
+        AStar,
+        JumpPoint
+    };
+
+    Pathfinder();
+
+    // Forget all per-tile state; call when the map is regenerated
+    void reset();
+
+    // Tiles from start (exclusive) to goal (inclusive), written into 'path' (cleared first).
+    // The goal tile itself need not be walkable. Returns false when the goal is unreachable.
+    bool findPath(const ChunkedTileMap& map, int startX, int startY, int goalX, int goalY,
+                  std::vector<std::pair<int, int>>& path, Method method = Method::AStar);
+
+    // First tile of that path; the start itself when unreachable or already at the goal
+    std::pair<int, int> nextStep(const ChunkedTileMap& map, int startX, int startY, int goalX, int goalY,
+                                 Method method = Method::AStar);
+
+    // Nodes expanded by the last search
+    size_t getLastExpanded() const { return lastExpanded; }
+
+private:
+    struct NodeState {
+        uint32_t stamp;   // Generation that last touched this tile
+        uint32_t g;       // Cost from start (valid only when stamp == generation)
+        uint32_t parent;  // Previous node on the best path (a jump point under JPS)
+    };
+
+    static constexpr uint32_t NO_CELL = UINT32_MAX;
+    static constexpr uint32_t INF = UINT32_MAX;
+
+    const ChunkedTileMap* map;
+    int mapWidth;
+    int mapHeight;
+    int chunksX;
+    std::vector<uint32_t> chunkSlot;   // Chunk directory index -> slot, NO_CELL until first touched
+    std::vector<uint32_t> slotChunk;   // Slot -> chunk directory index
+    std::vector<NodeState> nodes;      // CHUNK_TILES entries per slot
+    uint32_t generation;
+    RadixHeap<uint32_t, NoTrace> open;
+    int goalX;
+    int goalY;
+    size_t lastExpanded;
+
+    void bind(const ChunkedTileMap& target);
+    bool search(int startX, int startY, Method method);
+
+    uint32_t cellIndex(int x, int y);   // Assigns the chunk a slot on first use
+    void cellPosition(uint32_t cell, int& x, int& y) const;
+    NodeState& touch(uint32_t cell);    // Entry reset to "unvisited" if it is from an older query
+
+    bool passable(int x, int y) const {
+        return (x == goalX && y == goalY) || (map->inBounds(x, y) && map->walkable(x, y));
+    }
+    uint32_t heuristic(int x, int y) const;
+    void relax(uint32_t from, int x, int y, uint32_t g);
+
+    // Walk bits of tiles [baseX, baseX + 64) in row y with the goal counted as open; 0 off the map
+    uint64_t passableWord(int baseX, int y) const;
+
+    // JPS: follow (dx, dy) from (x, y); true with (x, y) moved to the jump point if one exists
+    bool jumpHorizontal(int& x, int y, int dx) const;
+    bool jumpVertical(int x, int& y, int dy) const;
+};
@@ -1,20 +1,10 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include <string>
-#include "DataStructures/Stack.h"
 #include "DataStructures/LinkedList.h"
 #include "ItemNew.h"
-
-struct Position {
-    int x, y;
-    
-    Position() : x(0), y(0) {}
-    Position(int x, int y) : x(x), y(y) {}
-    
-    bool operator==(const Position& other) const {
-        return x == other.x && y == other.y;
-    }
-};
+#include "Position.h"
+#include "MovementHistory.h"
 
 // Old Item struct - kept for backwards compatibility
 struct Item {
@@ -56,7 +46,7 @@ private:
     
     // Note: sf::Sprite removed - SFML 3.x requires texture, using shapes instead
     
-    Stack<Position> pathHistory;  // For backtracking
+    MovementHistory pathHistory;  // For backtracking (bounded, run-length encoded)
     // DEPRECATION: 2025-11-14 - Old Item system replaced by ItemNew
     // LinkedList<Item> inventory;   // DEPRECATED - Use inventoryNew instead
     LinkedList<ItemNew> inventoryNew;  // Primary item system with actions and effects
@@ -126,5 +116,5 @@ public:
     void update(float deltaTime);
     void render(sf::RenderWindow& window, float tileSize) const;
     
-    const Stack<Position>& getPathHistory() const { return pathHistory; }
+    const MovementHistory& getPathHistory() const { return pathHistory; }
 };
@@ -0,0 +1,29 @@
+#pragma once
+
+// Grid position (tile coordinates)
+struct Position {
+    int x, y;
+    
+    Position() : x(0), y(0) {}
+    Position(int x, int y) : x(x), y(y) {}
+    
+    bool operator==(const Position& other) const {
+        return x == other.x && y == other.y;
+    }
+    
+    bool operator!=(const Position& other) const {
+        return !(*this == other);
+    }
+};
+
+// CHANGE: 2026-10-16 - Inclusive tile rectangle (e.g. the tiles the camera can see)
+struct TileRect {
+    int left, top, right, bottom;
+    
+    TileRect() : left(0), top(0), right(-1), bottom(-1) {}
+    TileRect(int left, int top, int right, int bottom) : left(left), top(top), right(right), bottom(bottom) {}
+    
+    bool contains(int x, int y) const {
+        return x >= left && x <= right && y >= top && y <= bottom;
+    }
+};
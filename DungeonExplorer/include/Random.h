@@ -0,0 +1,131 @@
+// CHANGE: 2026-10-16 - One seeded RNG service for the whole run
+// - RandomStream: xoshiro256** (32 bytes of state, a few ns per number), seeded through
+//   SplitMix64 so that nearby seeds still give unrelated sequences
+// - Random: run-wide service. stream(domain, floor, index) derives an independent stream
+//   purely from (run seed, domain, floor, index), so the same run seed reproduces the
+//   same floors regardless of call order, and worker threads can each take their own
+//   stream without sharing state.
+// - shared(domain) streams are long-lived and main-thread only (combat rolls, loot drops).
+
+#pragma once
+#include <cstdint>
+#include <limits>
+
+enum class RandomDomain : uint64_t {
+    DungeonLayout = 1,  // Room placement, corridors
+    EnemySpawn,         // Enemy positions and types
+    Loot,               // Drop tables and fallback drops
+    Combat,             // Damage variance
+    Count
+};
+
+class RandomStream {
+public:
+    using result_type = uint64_t;
+
+    explicit RandomStream(uint64_t seed = 0) {
+        reseed(seed);
+    }
+
+    void reseed(uint64_t seed) {
+        for (uint64_t& word : state) {
+            word = splitMix(seed);
+        }
+    }
+
+    // Raw 64 bits; also makes this a UniformRandomBitGenerator for <random> distributions
+    uint64_t next() {
+        const uint64_t result = rotl(state[1] * 5, 7) * 9;
+        const uint64_t t = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 45);
+        return result;
+    }
+
+    uint64_t operator()() { return next(); }
+    static constexpr uint64_t min() { return 0; }
+    static constexpr uint64_t max() { return std::numeric_limits<uint64_t>::max(); }
+
+    // Uniform in [0, bound) without modulo bias (Lemire's multiply-and-reject); 0 if bound is 0
+    uint32_t below(uint32_t bound) {
+        if (bound == 0) return 0;
+        uint64_t product = (next() >> 32) * bound;
+        uint32_t low = static_cast<uint32_t>(product);
+        if (low < bound) {
+            const uint32_t threshold = static_cast<uint32_t>(-bound) % bound;
+            while (low < threshold) {
+                product = (next() >> 32) * bound;
+                low = static_cast<uint32_t>(product);
+            }
+        }
+        return static_cast<uint32_t>(product >> 32);
+    }
+
+    // Uniform in [lo, hi] (inclusive)
+    int range(int lo, int hi) {
+        if (hi <= lo) return lo;
+        return lo + static_cast<int>(below(static_cast<uint32_t>(hi - lo) + 1));
+    }
+
+    // True with probability percent / 100
+    bool chance(int percent) {
+        return static_cast<int>(below(100)) < percent;
+    }
+
+    // Uniform float in [0, 1)
+    float unit() {
+        return static_cast<float>(next() >> 40) * (1.0f / 16777216.0f);
+    }
+
+    // Independent child stream; the parent advances by one step
+    RandomStream split() {
+        return RandomStream(next());
+    }
+
+private:
+    uint64_t state[4];
+
+    static uint64_t rotl(uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    static uint64_t splitMix(uint64_t& x) {
+        uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+};
+
+class Random {
+public:
+    // Singleton access
+    static Random& getInstance();
+
+    // Set the run seed and restart every shared stream from it
+    void seed(uint64_t newSeed);
+    uint64_t getSeed() const { return runSeed; }
+
+    // Fresh stream for (domain, floor, index), e.g. one per floor or per worker thread.
+    // Pure function of the run seed: safe to call from any thread.
+    RandomStream stream(RandomDomain domain, uint64_t floor = 0, uint64_t index = 0) const;
+
+    // Long-lived per-subsystem stream (main thread only)
+    RandomStream& shared(RandomDomain domain) {
+        return sharedStreams[static_cast<uint64_t>(domain)];
+    }
+
+    // Seed for runs started without --seed
+    static uint64_t seedFromClock();
+
+private:
+    Random();
+    void resetSharedStreams();
+
+    uint64_t runSeed;
+    RandomStream sharedStreams[static_cast<uint64_t>(RandomDomain::Count)];
+};
@@ -1,10 +1,12 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include <memory>
+#include "Position.h"
 
 class Player;
 class Dungeon;
 class EnemyManager;
+class FieldOfView;
 
 class Renderer {
 private:
@@ -32,11 +34,20 @@ public:
     
     void renderDungeon(const Dungeon& dungeon, int currentFloor = 1);
     void renderPlayer(const Player& player);
-    void renderEnemies(const EnemyManager& enemyManager);
+    void renderEnemies(const EnemyManager& enemyManager, const FieldOfView* sight = nullptr);
+    void renderFog(const Dungeon& dungeon);  // After the world layers, before lighting and UI
     
     void setGameView();
     void setUIView();
     
+    // CHANGE: 2026-10-16 - Scrolling camera
+    // gameView centres on the player, clamped so it never shows past the floor's edges
+    // (a floor smaller than the window stays anchored top-left). World layers draw only
+    // what lies in getVisibleTiles(), so their cost follows the window size, not the floor's.
+    void updateCamera(const Player& player, const Dungeon& dungeon);
+    TileRect getVisibleTiles() const;  // Tiles under gameView, plus a one-tile margin
+    
+    // Tile coordinates <-> window pixels, through the camera
     sf::Vector2f worldToScreen(float x, float y) const;
     sf::Vector2f screenToWorld(float x, float y) const;
     
@@ -1,6 +1,7 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include <string>
+#include <string_view>
 #include <memory>
 #include <vector>
 #include "DataStructures/Tree.h"
@@ -42,10 +43,13 @@ struct Skill {
           defenseBonus(0), hpPerSecond(0), critChance(0.0f) {}
 };
 
+// CHANGE: 2026-10-16 - Skills are addressed by BinaryTree handles instead of shared_ptr nodes
+using SkillHandle = BinaryTree<Skill>::Handle;
+
 class SkillTree {
 private:
     BinaryTree<Skill> tree;
-    std::shared_ptr<BinaryTree<Skill>::Node> root;
+    SkillHandle root;
     
     int availablePoints;
 
@@ -53,9 +57,9 @@ public:
     SkillTree();
     
     void initialize();
-    void unlockSkill(std::shared_ptr<BinaryTree<Skill>::Node> node);
+    void unlockSkill(SkillHandle node);
     
-    bool canUnlock(std::shared_ptr<BinaryTree<Skill>::Node> node) const;
+    bool canUnlock(SkillHandle node) const;
     void addPoints(int points);
     
     // Get skill by hotkey (1-5)
@@ -68,7 +72,12 @@ public:
     void updateCooldowns();
     
     const BinaryTree<Skill>& getTree() const { return tree; }
-    std::shared_ptr<BinaryTree<Skill>::Node> getRoot() { return root; }
+    SkillHandle getRoot() const { return root; }
+    
+    // Handle of the skill with this id, or BinaryTree<Skill>::INVALID_HANDLE
+    SkillHandle findSkill(std::string_view id) const;
+    Skill& getSkill(SkillHandle node) { return tree.get(node); }
+    const Skill& getSkill(SkillHandle node) const { return tree.get(node); }
     
     int getAvailablePoints() const { return availablePoints; }
     
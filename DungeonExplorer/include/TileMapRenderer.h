@@ -0,0 +1,116 @@
+// CHANGE: 2026-10-16 - Cached vertex-array tile layer for Dungeon::render
+// Tiles are baked into vertex arrays per 64x64 chunk of the ChunkedTileMap, one array per
+// texture (plus one untextured array for colour fallbacks and one for the stair sparkles).
+// A frame then costs a few draw calls per visible chunk instead of one sprite per tile,
+// and texture lookups happen only while a chunk is being (re)built.
+// - markDirty() flags the chunk holding a changed tile; it is rebuilt on its next draw
+// - Only chunks that intersect the render target's current view are built or drawn
+// - A new floor (reset()), tile size or floor theme rebuilds everything lazily
+// - drawFog() shades the visible part of the view from a FieldOfView, one quad per run of
+//   equally fogged tiles, into a vertex array that is reused every frame
+// - Built chunks sit in an LRU list; past the memory budget the least recently drawn
+//   chunks that are off screen are freed, so a huge floor never holds every mesh at once
+
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include "ChunkedTileMap.h"
+
+class FieldOfView;
+
+class TileMapRenderer {
+public:
+    TileMapRenderer();
+
+    // Drop every cached mesh (call when the map is regenerated)
+    void reset();
+
+    // The tile at (x, y) changed; its chunk is rebuilt before it is drawn again
+    void markDirty(int x, int y);
+
+    // Draw the map chunks visible in target's current view. currentFloor picks the floor theme.
+    void draw(sf::RenderTarget& target, const ChunkedTileMap& map, float tileSize, int currentFloor);
+
+    // Shade the tiles in target's view: unexplored black, explored but out of sight dimmed
+    void drawFog(sf::RenderTarget& target, const FieldOfView& sight, float tileSize);
+
+    // Vertex memory the cached chunks may hold before off-screen ones are evicted
+    void setMemoryBudget(size_t bytes) { memoryBudget = bytes; }
+    size_t getMemoryBudget() const { return memoryBudget; }
+    size_t getResidentBytes() const { return residentBytes; }
+
+    size_t getLastDrawCalls() const { return lastDrawCalls; }
+    size_t getBuiltChunks() const { return builtChunks; }
+    size_t getEvictedChunks() const { return evictedChunks; }  // Since the last reset()
+
+    static constexpr size_t DEFAULT_MEMORY_BUDGET = size_t(64) << 20;
+
+private:
+    // Textures a tile can use; resolved by name on the first draw
+    enum TextureSlot {
+        WallTexture,
+        FloorTexture,
+        FloorVariant1,
+        FloorVariant2,
+        FloorVariant3,
+        FloorVariant4,
+        StairsDownTexture,
+        StairsUpTexture,
+        DoorTexture,
+        ChestTexture,
+        TextureSlotCount
+    };
+
+    // Per-chunk draw layers: one per texture slot, then fallback colours, then sparkles
+    static constexpr size_t FALLBACK_LAYER = TextureSlotCount;
+    static constexpr size_t SPARKLE_LAYER = TextureSlotCount + 1;
+    static constexpr size_t LAYER_COUNT = TextureSlotCount + 2;
+
+    struct ChunkMesh {
+        std::array<sf::VertexArray, LAYER_COUNT> layers;
+        bool built = false;      // Layers match the tiles (false after markDirty)
+        bool resident = false;   // Layers hold vertices and the chunk is in the LRU list
+        size_t bytes = 0;
+        unsigned int lastDrawnFrame = 0;
+        int newer = -1;          // LRU neighbours (mesh indices)
+        int older = -1;
+    };
+
+    std::vector<ChunkMesh> meshes;  // chunkCountX * chunkCountY of the map last drawn
+    int chunksX;
+    int chunksY;
+    int mapWidth;
+    int mapHeight;
+    float meshTileSize;
+    int meshFloor;
+
+    std::array<const sf::Texture*, TextureSlotCount> textures;
+    const sf::Texture* sparkleTexture;
+    bool texturesResolved;
+
+    size_t lastDrawCalls;
+    size_t builtChunks;
+
+    int lruNewest;  // Most recently drawn resident chunk, or -1
+    int lruOldest;
+    unsigned int frame;
+    size_t residentBytes;
+    size_t memoryBudget;
+    size_t evictedChunks;
+
+    sf::VertexArray fog;  // Rebuilt by every drawFog(), capacity kept
+
+    void resolveTextures();
+    void bind(const ChunkedTileMap& map, float tileSize, int currentFloor);
+    void build(ChunkMesh& mesh, const ChunkedTileMap& map, int chunkX, int chunkY);
+    void touch(int index);   // Move a chunk to the newest end of the LRU list
+    void unlink(int index);
+    void evict(int index);   // Free a chunk's vertices
+    void trimToBudget();
+
+    // Texture slot for a tile, or TextureSlotCount when it only has a fallback colour
+    size_t textureSlotFor(uint8_t tile, int x, int y) const;
+};
@@ -48,6 +48,15 @@ private:
     bool skillTreeVisible;
     bool miniMapVisible;
     
+    // CHANGE: 2026-10-16 - Cached mini-map geometry, rebuilt only when the floor layout changes
+    sf::VertexArray miniMapCells;           // Walkable cells as triangles, relative to the map origin
+    unsigned int miniMapFloorId;            // Dungeon::getFloorId() the cache was built for
+    unsigned int miniMapLayoutVersion;
+    unsigned int miniMapExploredVersion;    // FieldOfView::getExploredVersion(): only explored cells are lit
+    int miniMapCellTiles;                   // Map tiles per mini-map cell (1 on small floors)
+    float miniMapCellPx;                    // Pixel size of one cell
+    void rebuildMiniMap(const Dungeon& dungeon);
+    
     // Helper rendering methods
     void renderHUD(sf::RenderWindow& window, const Player& player, class SkillTree* skillTree, int currentFloor = 1);
     void renderMiniMap(sf::RenderWindow& window, const Dungeon& dungeon, const Player& player, const EnemyManager& enemies);
@@ -57,7 +66,8 @@ private:
     void renderSkillHotkeys(sf::RenderWindow& window, const Player& player, class SkillTree* skillTree);
     void renderFloatingTexts(sf::RenderWindow& window);
     void renderScreenFlash(sf::RenderWindow& window);
-    void renderCharacterNames(sf::RenderWindow& window, const Player& player, const EnemyManager& enemies, float tileSize);
+    void renderCharacterNames(sf::RenderWindow& window, const Player& player, const EnemyManager& enemies, float tileSize,
+                              const FieldOfView& sight);
     
     void createMainMenu();
     void createHUD();
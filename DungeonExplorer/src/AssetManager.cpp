@@ -29,18 +29,17 @@ bool AssetManager::loadTexture(const std::string& key, const std::string& filePa
     return true;
 }
 
-sf::Texture* AssetManager::getTexture(const std::string& key) {
-    auto it = textures.find(key);
-    if (it != textures.end()) {
-        return it->second.get();
+sf::Texture* AssetManager::getTexture(std::string_view key) {
+    if (auto* texture = textures.find(key)) {
+        return texture->get();
     }
     
     std::cerr << "[AssetManager] Texture not found: " << key << std::endl;
     return nullptr;
 }
 
-bool AssetManager::hasTexture(const std::string& key) const {
-    return textures.find(key) != textures.end();
+bool AssetManager::hasTexture(std::string_view key) const {
+    return textures.contains(key);
 }
 
 void AssetManager::clear() {
@@ -49,15 +48,14 @@ void AssetManager::clear() {
     std::cout << "[AssetManager] Cleared all assets" << std::endl;
 }
 
-sf::Texture* AssetManager::getSpritesheet(const std::string& sheetName) {
-    auto it = spritesheets.find(sheetName);
-    if (it != spritesheets.end()) {
-        return it->second.get();
+sf::Texture* AssetManager::getSpritesheet(std::string_view sheetName) {
+    if (auto* sheet = spritesheets.find(sheetName)) {
+        return sheet->get();
     }
     return nullptr;
 }
 
-bool AssetManager::createSpriteFromSheet(const std::string& sheetName, int tileIndex, sf::Sprite& outSprite, int columns, int tileSize, int spacing) {
+bool AssetManager::createSpriteFromSheet(std::string_view sheetName, int tileIndex, sf::Sprite& outSprite, int columns, int tileSize, int spacing) {
     sf::Texture* sheet = getSpritesheet(sheetName);
     if (!sheet) {
         std::cerr << "[AssetManager] Spritesheet not found: " << sheetName << std::endl;
@@ -0,0 +1,192 @@
+// CHANGE: 2026-10-16 - Bit-packed cellular-automata caves (see CaveGenerator.h)
+
+#include "CaveGenerator.h"
+#include "ChunkedTileMap.h"
+#include "BitScan.h"
+#include "DataStructures/DisjointSet.h"
+#include <algorithm>
+#include <utility>
+
+namespace {
+    // Bits [x0, x1) of a row set to 1
+    void setRange(uint64_t* rowBits, int x0, int x1) {
+        while (x0 < x1) {
+            const int word = x0 >> 6;
+            const int end = std::min(x1, (word + 1) << 6);
+            const int count = end - x0;
+            const uint64_t mask = count == 64 ? ~0ull : ((1ull << count) - 1) << (x0 & 63);
+            rowBits[word] |= mask;
+            x0 = end;
+        }
+    }
+}
+
+CaveGenerator::CaveGenerator(int smoothingPasses, int wallSixteenths)
+    : smoothingPasses(smoothingPasses), wallSixteenths(std::clamp(wallSixteenths, 0, 16)), width(0), height(0), wordsPerRow(0), openCount(0), pocketCount(0) {}
+
+void CaveGenerator::generate(int newWidth, int newHeight, RandomStream& rng) {
+    width = std::max(newWidth, 3);
+    height = std::max(newHeight, 3);
+    wordsPerRow = (width + 63) / 64;
+    
+    // Inner rows may be open everywhere except the left and right border columns
+    rowMask.assign(wordsPerRow, 0);
+    setRange(rowMask.data(), 1, width - 1);
+    
+    bits.assign(static_cast<size_t>(wordsPerRow) * height, 0);
+    scratch.assign(bits.size(), 0);
+    
+    randomFill(rng);
+    for (int pass = 0; pass < smoothingPasses; pass++) {
+        smooth();
+    }
+    keepLargestRegion();
+}
+
+void CaveGenerator::randomFill(RandomStream& rng) {
+    for (int y = 1; y < height - 1; y++) {
+        uint64_t* rowBits = row(y);
+        for (int k = 0; k < wordsPerRow; k++) {
+            // Four random words give each tile a random 4-bit number r; wall where r < threshold
+            uint64_t below = 0;
+            uint64_t equal = ~0ull;
+            for (int bit = 3; bit >= 0; bit--) {
+                const uint64_t r = rng.next();
+                if ((wallSixteenths >> bit) & 1) {
+                    below |= equal & ~r;
+                    equal &= r;
+                } else {
+                    equal &= ~r;
+                }
+            }
+            rowBits[k] = ~below & rowMask[k];
+        }
+    }
+}
+
+void CaveGenerator::smooth() {
+    const uint64_t ALL = ~0ull;
+    
+    // Border rows stay wall, so every row read below is inside the map
+    std::fill(scratch.begin(), scratch.begin() + wordsPerRow, 0);
+    std::fill(scratch.end() - wordsPerRow, scratch.end(), 0);
+    
+    for (int y = 1; y < height - 1; y++) {
+        const uint64_t* rows[3] = {row(y - 1), row(y), row(y + 1)};
+        uint64_t* out = &scratch[static_cast<size_t>(y) * wordsPerRow];
+        
+        for (int k = 0; k < wordsPerRow; k++) {
+            // 4-bit counter per tile, one bit-plane per word
+            uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+            auto add = [&](uint64_t in) {
+                uint64_t carry = s0 & in;
+                s0 ^= in;
+                in = carry;
+                carry = s1 & in;
+                s1 ^= in;
+                in = carry;
+                carry = s2 & in;
+                s2 ^= in;
+                s3 |= carry;
+            };
+            
+            for (const uint64_t* r : rows) {
+                // Padding bits past the width are 0 (closed), so they count as wall too
+                const uint64_t wall = ~r[k];
+                const uint64_t before = k > 0 ? ~r[k - 1] : ALL;
+                const uint64_t after = k + 1 < wordsPerRow ? ~r[k + 1] : ALL;
+                add((wall << 1) | (before >> 63));  // Tile x - 1
+                add(wall);
+                add((wall >> 1) | (after << 63));   // Tile x + 1
+            }
+            
+            const uint64_t fiveOrMore = s3 | (s2 & (s1 | s0));
+            out[k] = ~fiveOrMore & rowMask[k];
+        }
+    }
+    
+    bits.swap(scratch);
+}
+
+int CaveGenerator::nextTile(const uint64_t* rowBits, int x, bool open) const {
+    if (x >= width) return width;
+    int k = x >> 6;
+    uint64_t word = (open ? rowBits[k] : ~rowBits[k]) & (~0ull << (x & 63));
+    while (word == 0) {
+        if (++k >= wordsPerRow) return width;
+        word = open ? rowBits[k] : ~rowBits[k];
+    }
+    return std::min(width, (k << 6) + lowestBit(word));
+}
+
+void CaveGenerator::collectRuns() {
+    runs.clear();
+    rowRuns.assign(height + 1, 0);
+    
+    for (int y = 0; y < height; y++) {
+        rowRuns[y] = runs.size();
+        const uint64_t* rowBits = row(y);
+        int x = nextTile(rowBits, 0, true);
+        while (x < width) {
+            const int end = nextTile(rowBits, x, false);
+            runs.push_back({x, end});
+            x = nextTile(rowBits, end, true);
+        }
+    }
+    rowRuns[height] = runs.size();
+}
+
+void CaveGenerator::keepLargestRegion() {
+    collectRuns();
+    openCount = 0;
+    pocketCount = 0;
+    if (runs.empty()) return;
+    
+    // Runs in neighbouring rows that share a column are 4-connected
+    DisjointSet<NoTrace> regions(runs.size());
+    for (int y = 1; y < height; y++) {
+        size_t above = rowRuns[y - 1];
+        size_t here = rowRuns[y];
+        while (above < rowRuns[y] && here < rowRuns[y + 1]) {
+            const Run& a = runs[above];
+            const Run& b = runs[here];
+            if (a.x0 < b.x1 && b.x0 < a.x1) {
+                regions.unite(static_cast<int>(above), static_cast<int>(here));
+            }
+            if (a.x1 < b.x1) above++;
+            else here++;
+        }
+    }
+    
+    std::vector<size_t> regionSize(runs.size(), 0);
+    for (size_t i = 0; i < runs.size(); i++) {
+        regionSize[regions.find(static_cast<int>(i))] += runs[i].x1 - runs[i].x0;
+    }
+    const int largest = static_cast<int>(std::max_element(regionSize.begin(), regionSize.end()) - regionSize.begin());
+    openCount = regionSize[largest];
+    pocketCount = regions.setCount() - 1;
+    
+    // Rebuild the bits from the kept runs only; every pocket goes back to wall
+    std::fill(bits.begin(), bits.end(), 0);
+    for (int y = 0; y < height; y++) {
+        for (size_t i = rowRuns[y]; i < rowRuns[y + 1]; i++) {
+            if (regions.find(static_cast<int>(i)) == largest) {
+                setRange(row(y), runs[i].x0, runs[i].x1);
+            }
+        }
+    }
+}
+
+void CaveGenerator::writeTo(ChunkedTileMap& map, uint8_t openTile) const {
+    const int maxX = std::min(width, map.width());
+    const int maxY = std::min(height, map.height());
+    for (int y = 0; y < maxY; y++) {
+        const uint64_t* rowBits = row(y);
+        int x = nextTile(rowBits, 0, true);
+        while (x < maxX) {
+            const int end = std::min(nextTile(rowBits, x, false), maxX);
+            map.fillRun(x, end, y, openTile);
+            x = nextTile(rowBits, end, true);
+        }
+    }
+}
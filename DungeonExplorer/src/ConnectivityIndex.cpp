@@ -0,0 +1,181 @@
+// CHANGE: 2026-10-16 - Run-based connectivity labels (see ConnectivityIndex.h)
+
+#include "ConnectivityIndex.h"
+#include "ChunkedTileMap.h"
+#include "BitScan.h"
+#include <algorithm>
+#include <cstdint>
+
+ConnectivityIndex::ConnectivityIndex()
+    : width(0), height(0), stale(true), rebuilds(0), updates(0) {}
+
+void ConnectivityIndex::rebuild(const ChunkedTileMap& map) {
+    width = map.width();
+    height = map.height();
+    rows.resize(height);
+    
+    // Runs straight from the walk words: each word yields its open stretches with a few ctz's
+    int runCount = 0;
+    for (int y = 0; y < height; y++) {
+        std::vector<Run>& row = rows[y];
+        row.clear();
+        for (int wordX = 0; wordX < width; wordX += ChunkedTileMap::CHUNK_SIZE) {
+            uint64_t word = map.walkWord(wordX, y);
+            while (word) {
+                const int start = lowestBit(word);
+                const uint64_t rest = ~(word >> start);
+                const int length = rest ? lowestBit(rest) : 64;
+                const int x0 = wordX + start;
+                
+                if (!row.empty() && row.back().x1 == x0) {
+                    row.back().x1 = x0 + length;  // Continues across a word boundary
+                } else {
+                    row.push_back({x0, x0 + length, runCount++});
+                }
+                word = start + length >= 64 ? 0 : word & (~0ull << (start + length));
+            }
+        }
+    }
+    
+    // Runs in neighbouring rows that share a column are 4-connected
+    regions.reset(runCount);
+    for (int y = 1; y < height; y++) {
+        const std::vector<Run>& above = rows[y - 1];
+        const std::vector<Run>& here = rows[y];
+        size_t a = 0;
+        size_t b = 0;
+        while (a < above.size() && b < here.size()) {
+            if (above[a].x0 < here[b].x1 && here[b].x0 < above[a].x1) {
+                regions.unite(above[a].node, here[b].node);
+            }
+            if (above[a].x1 < here[b].x1) a++;
+            else b++;
+        }
+    }
+    
+    stale = false;
+    rebuilds++;
+}
+
+int ConnectivityIndex::runAt(int x, int y) const {
+    if (x < 0 || y < 0 || x >= width || y >= height) return -1;
+    const std::vector<Run>& row = rows[y];
+    
+    // Last run starting at or before x
+    auto it = std::upper_bound(row.begin(), row.end(), x, [](int value, const Run& run) { return value < run.x0; });
+    if (it == row.begin()) return -1;
+    --it;
+    return x < it->x1 ? static_cast<int>(it - row.begin()) : -1;
+}
+
+int ConnectivityIndex::regionOf(int x, int y) const {
+    const int run = runAt(x, y);
+    return run < 0 ? -1 : regions.find(rows[y][run].node);
+}
+
+void ConnectivityIndex::tileChanged(const ChunkedTileMap& map, int x, int y) {
+    if (stale) return;  // Everything gets relabelled anyway
+    if (map.width() != width || map.height() != height) {
+        stale = true;
+        return;
+    }
+    if (!map.inBounds(x, y)) return;
+    
+    const bool walkable = map.walkable(x, y);
+    if (walkable == (runAt(x, y) >= 0)) return;
+    
+    updates++;
+    if (walkable) {
+        open(x, y);
+    } else {
+        close(map, x, y);
+    }
+}
+
+void ConnectivityIndex::joinAt(int node, int x, int y) {
+    const int run = runAt(x, y);
+    if (run >= 0) {
+        regions.unite(node, rows[y][run].node);
+    }
+}
+
+void ConnectivityIndex::open(int x, int y) {
+    std::vector<Run>& row = rows[y];
+    auto right = std::upper_bound(row.begin(), row.end(), x, [](int value, const Run& run) { return value < run.x0; });
+    const bool touchesLeft = right != row.begin() && std::prev(right)->x1 == x;
+    const bool touchesRight = right != row.end() && right->x0 == x + 1;
+    
+    // Extend or bridge the runs beside the tile; a lone tile becomes a run of its own
+    int node;
+    if (touchesLeft && touchesRight) {
+        Run& left = *std::prev(right);
+        left.x1 = right->x1;
+        regions.unite(left.node, right->node);
+        node = left.node;
+        row.erase(right);
+    } else if (touchesLeft) {
+        Run& left = *std::prev(right);
+        left.x1 = x + 1;
+        node = left.node;
+    } else if (touchesRight) {
+        right->x0 = x;
+        node = right->node;
+    } else {
+        node = regions.add();
+        row.insert(right, Run{x, x + 1, node});
+    }
+    
+    joinAt(node, x, y - 1);
+    joinAt(node, x, y + 1);
+}
+
+void ConnectivityIndex::close(const ChunkedTileMap& map, int x, int y) {
+    std::vector<Run>& row = rows[y];
+    const int index = runAt(x, y);
+    Run& run = row[index];
+    
+    // Cut the tile out of its run; both halves keep the run's node
+    if (run.x1 - run.x0 == 1) {
+        row.erase(row.begin() + index);
+    } else if (x == run.x0) {
+        run.x0++;
+    } else if (x == run.x1 - 1) {
+        run.x1--;
+    } else {
+        const Run tail{x + 1, run.x1, run.node};
+        run.x1 = x;
+        row.insert(row.begin() + index + 1, tail);
+    }
+    
+    if (!neighboursStayJoined(map, x, y)) {
+        stale = true;  // The region may have split; a full relabel settles it
+    }
+}
+
+bool ConnectivityIndex::neighboursStayJoined(const ChunkedTileMap& map, int x, int y) const {
+    // The 8 tiles around (x, y) in ring order; consecutive ring tiles are 4-adjacent, so the
+    // open neighbours stay joined when they all lie on one arc of open ring tiles
+    static const int RING_X[8] = {0, 1, 1, 1, 0, -1, -1, -1};
+    static const int RING_Y[8] = {-1, -1, 0, 1, 1, 1, 0, -1};
+    bool open[8];
+    int openCount = 0;
+    for (int i = 0; i < 8; i++) {
+        const int nx = x + RING_X[i];
+        const int ny = y + RING_Y[i];
+        open[i] = map.inBounds(nx, ny) && map.walkable(nx, ny);
+        openCount += open[i];
+    }
+    if (openCount == 8) return true;
+    
+    int arcsWithNeighbour = 0;
+    for (int i = 0; i < 8; i++) {
+        if (!open[i] || open[(i + 7) % 8]) continue;  // Not the first tile of an arc
+        
+        bool hasNeighbour = false;
+        for (int j = i; open[j % 8]; j++) {
+            hasNeighbour |= (j % 2) == 0;  // Even ring slots are the orthogonal neighbours
+        }
+        arcsWithNeighbour += hasNeighbour;
+    }
+    return arcsWithNeighbour <= 1;
+}
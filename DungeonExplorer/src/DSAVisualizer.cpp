@@ -2,6 +2,7 @@
 #include <cmath>
 #include <cstdint>
 #include <array>
+#include <vector>
 
 DSAVisualizer::DSAVisualizer() : font(nullptr) {
 }
@@ -11,22 +12,22 @@ void DSAVisualizer::setFont(const sf::Font* fontPtr) {
 }
 
 void DSAVisualizer::renderStackTrail(sf::RenderWindow& window, const Player& player, float tileSize) {
-    Position currentPos = player.getPosition();
-    
-    for (int i = 0; i < 5; i++) {
+    // CHANGE: 2026-10-16 - Footprints follow the real movement history (newest first)
+    int i = 0;
+    player.getPathHistory().forEachReverse([&](const Position& pos) {
         sf::CircleShape footprint(4.f - i * 0.5f);
         float offsetX = (i % 2 == 0) ? -3.f : 3.f;
-        float offsetY = -i * 8.f;
         
         footprint.setPosition(sf::Vector2f(
-            currentPos.x * tileSize + tileSize * 0.5f + offsetX,
-            currentPos.y * tileSize + tileSize * 0.5f + offsetY
+            pos.x * tileSize + tileSize * 0.5f + offsetX,
+            pos.y * tileSize + tileSize * 0.5f
         ));
         
         float alpha = 180.f * std::pow(0.65f, static_cast<float>(i));
         footprint.setFillColor(sf::Color(100, 200, 255, static_cast<std::uint8_t>(alpha)));
         window.draw(footprint);
-    }
+        return ++i < 5;
+    });
     
     // CHANGE: 2025-11-14 - Add null pointer validation for font before rendering text
     if (font && font->getInfo().family != "") {
@@ -42,25 +43,28 @@ void DSAVisualizer::renderGraphPaths(sf::RenderWindow& window, const Dungeon& du
     
     if (rooms.size() < 2) return;
     
-    for (size_t i = 0; i < rooms.size() - 1; i++) {
-        const auto& room1 = rooms[i];
-        const auto& room2 = rooms[i + 1];
-        
-        sf::Vector2f start(
-            (room1.x + room1.width / 2.f) * tileSize,
-            (room1.y + room1.height / 2.f) * tileSize
-        );
-        sf::Vector2f end(
-            (room2.x + room2.width / 2.f) * tileSize,
-            (room2.y + room2.height / 2.f) * tileSize
-        );
+    // CHANGE: 2026-10-17 - Draw the room graph's real edges (room ids are indices into rooms)
+    auto roomCenter = [&](int roomId) {
+        const auto& room = rooms[roomId];
+        return sf::Vector2f((room.x + room.width / 2.f) * tileSize,
+                            (room.y + room.height / 2.f) * tileSize);
+    };
+    const auto& graph = dungeon.getGraph();
+    
+    for (const auto& room : rooms) {
+        sf::Vector2f start = roomCenter(room.id);
         
-        // Reduced alpha from 100 to 60 for subtler appearance
-        std::array<sf::Vertex, 2> line = {{
-            {{start.x, start.y}, sf::Color(80, 200, 80, 60)},
-            {{end.x, end.y}, sf::Color(80, 200, 80, 60)}
-        }};
-        window.draw(line.data(), 2, sf::PrimitiveType::Lines);
+        graph.forEachNeighbor(room.id, [&](int neighbor, int) {
+            if (neighbor < room.id) return;  // Each undirected edge once
+            sf::Vector2f end = roomCenter(neighbor);
+            
+            // Reduced alpha from 100 to 60 for subtler appearance
+            std::array<sf::Vertex, 2> line = {{
+                {{start.x, start.y}, sf::Color(80, 200, 80, 60)},
+                {{end.x, end.y}, sf::Color(80, 200, 80, 60)}
+            }};
+            window.draw(line.data(), 2, sf::PrimitiveType::Lines);
+        });
         
         sf::CircleShape vertex(3.f);
         vertex.setPosition(sf::Vector2f(start.x - 3.f, start.y - 3.f));
@@ -68,16 +72,17 @@ void DSAVisualizer::renderGraphPaths(sf::RenderWindow& window, const Dungeon& du
         window.draw(vertex);
     }
     
-    if (!rooms.empty()) {
-        const auto& lastRoom = rooms.back();
-        sf::Vector2f lastPos(
-            (lastRoom.x + lastRoom.width / 2.f) * tileSize,
-            (lastRoom.y + lastRoom.height / 2.f) * tileSize
-        );
-        sf::CircleShape vertex(3.f);
-        vertex.setPosition(sf::Vector2f(lastPos.x - 3.f, lastPos.y - 3.f));
-        vertex.setFillColor(sf::Color(80, 200, 80, 80));
-        window.draw(vertex);
+    // CHANGE: 2026-10-16 - Highlight the real shortest route from entrance to stairs
+    std::vector<int> route = dungeon.findShortestPath(dungeon.getStartRoomId(), dungeon.getStairsRoomId());
+    for (size_t i = 0; i + 1 < route.size(); i++) {
+        sf::Vector2f start = roomCenter(route[i]);
+        sf::Vector2f end = roomCenter(route[i + 1]);
+        
+        std::array<sf::Vertex, 2> line = {{
+            {{start.x, start.y}, sf::Color(255, 215, 80, 110)},
+            {{end.x, end.y}, sf::Color(255, 215, 80, 110)}
+        }};
+        window.draw(line.data(), 2, sf::PrimitiveType::Lines);
     }
 }
 
@@ -4,44 +4,113 @@
 // - Added debug logging for stairs placement
 
 #include "Dungeon.h"
-#include "AssetManager.h"
+#include "FloorSnapshot.h"
 #include <iostream>
-#include <random>
-#include <ctime>
-#include <queue>
-#include <map>
+#include <limits>
+#include <algorithm>
+#include <atomic>
+#include <memory>
 
-Dungeon::Dungeon() : startRoomId(0), currentRoomId(0), stairsX(-1), stairsY(-1) {
-    grid.resize(GRID_HEIGHT, std::vector<TileType>(GRID_WIDTH, TileType::Empty));
+// Floors may be generated on a worker thread (FloorPreloader), so ids come from an atomic
+static std::atomic<unsigned int> nextFloorId{1};
+
+Dungeon::Dungeon() : layoutVersion(0), floorId(0), clearDoorsOpened(false), startRoomId(0), currentRoomId(0), stairsRoomId(-1), stairsX(-1), stairsY(-1),
+                     routeTableVersion(0), routeTableBuilt(false), entranceRoutesVersion(0), sourceRoutesVersion(0) {
+    // Corridor weights are small Manhattan distances, the radix heap's best case
+    roomGraph.setQueueKind(Graph<int, CountingTrace>::QueueKind::Radix);
+    tileMap.reset(DEFAULT_WIDTH, DEFAULT_HEIGHT, static_cast<uint8_t>(TileType::Empty));
 }
 
-void Dungeon::generate(int numRooms) {
+void Dungeon::generate(RandomStream rng, int numRooms, int width, int height, const std::string& generator) {
+    // Room placement keeps a margin of 10 tiles, so anything smaller has no valid positions
+    const int MIN_SIZE = 12;
+    width = std::max(width, MIN_SIZE);
+    height = std::max(height, MIN_SIZE);
+    
     std::cout << "\n[Dungeon] Generating dungeon with " << numRooms << " rooms..." << std::endl;
-    std::cout << "[Dungeon] Grid size: " << GRID_WIDTH << "x" << GRID_HEIGHT << " tiles" << std::endl;
+    std::cout << "[Dungeon] Grid size: " << width << "x" << height << " tiles" << std::endl;
+    
+    std::unique_ptr<DungeonGenerator> layout = DungeonGenerator::create(generator);
+    if (!layout) {
+        std::cerr << "[Dungeon] Unknown generator '" << generator << "', using classic" << std::endl;
+        layout = DungeonGenerator::create("classic");
+    }
+    
+    floorId = nextFloorId.fetch_add(1, std::memory_order_relaxed);
+    layoutRng = rng;
+    
+    // CHANGE: 2026-10-16 - A layout whose stairs can't be reached from the entrance is rolled
+    // again from the same stream (so the floor stays reproducible)
+    const int MAX_LAYOUT_ATTEMPTS = 4;
+    for (int attempt = 1; ; attempt++) {
+        buildLayout(layout, numRooms, width, height);
+        if (stairsReachable()) break;
+        
+        if (attempt == MAX_LAYOUT_ATTEMPTS) {
+            std::cerr << "[Dungeon] Stairs still unreachable after " << attempt << " layouts, keeping the last one" << std::endl;
+            break;
+        }
+        std::cerr << "[Dungeon] Stairs unreachable from the entrance, regenerating (attempt "
+                  << attempt + 1 << ")" << std::endl;
+    }
     
-    // Clear previous data
-    grid.clear();
-    grid.resize(GRID_HEIGHT, std::vector<TileType>(GRID_WIDTH, TileType::Wall));
+    std::cout << "[Dungeon] Generation complete! (" << tileMap.allocatedChunks() << " chunks, "
+              << tileMap.memoryBytes() / 1024 << " KiB)" << std::endl;
+}
+
+void Dungeon::buildLayout(std::unique_ptr<DungeonGenerator>& layout, int numRooms, int width, int height) {
+    // Clear previous data (everything starts as solid wall; chunks allocate as rooms are carved)
+    tileMap.reset(width, height, static_cast<uint8_t>(TileType::Wall));
+    tileRenderer.reset();
+    fieldOfView.reset(width, height);
+    layoutVersion++;
+    pathfinder.reset();
     rooms.clear();
     roomGraph.clear();
+    entranceRoutes = RouteTree();
+    sourceRoutes = RouteTree();
+    stairsRoomId = -1;
+    
+    std::vector<RoomLink> links;
+    layout->generate(GenerationParams{numRooms, width, height}, layoutRng, tileMap, rooms, links);
+    if (rooms.size() < 2 && layout->getName() != "classic") {
+        // E.g. a cave too broken up for two rooms: a floor without stairs would be a dead end
+        std::cerr << "[Dungeon] " << layout->getName() << " placed " << rooms.size()
+                  << " rooms, regenerating with classic" << std::endl;
+        layout = DungeonGenerator::create("classic");
+        tileMap.reset(width, height, static_cast<uint8_t>(TileType::Wall));
+        layout->generate(GenerationParams{numRooms, width, height}, layoutRng, tileMap, rooms, links);
+    }
+    
+    // First room is the entrance; the last one keeps the original "exit room" look
+    if (!rooms.empty()) {
+        rooms.front().type = TileType::Start;
+        if (rooms.size() > 1) rooms.back().type = TileType::Exit;
+        startRoomId = rooms[0].id;
+        currentRoomId = startRoomId;
+    }
     
-    generateRooms(numRooms);
-    connectRooms();
-    fillGrid();
+    connectRooms(links);
+    fillGrid(links, layout->carvesCorridors());
     
     // TASK D: Place stairs in furthest room from entrance
     if (rooms.size() > 1) {
-        // Use Dijkstra to find furthest room
-        std::unordered_map<int, int> distances = roomGraph.dijkstra(startRoomId);
+        // Furthest room by shortest-path distance. One single-source search: the all-pairs
+        // route table is O(rooms^3) to build and large generated floors can have thousands.
+        // The tree is kept, so entrance routes (e.g. to the stairs) need no further search.
+        buildEntranceRoutes();
         int furthestRoom = startRoomId;
         int maxDistance = 0;
         
-        for (const auto& [roomId, dist] : distances) {
-            if (dist > maxDistance && dist < 999999) {
+        for (const auto& room : rooms) {
+            int index = roomGraph.indexOf(room.id);
+            int dist = entranceRoutes.reaches(index) ? entranceRoutes.distance[index] : std::numeric_limits<int>::max();
+            if (dist > maxDistance && dist != std::numeric_limits<int>::max()) {
                 maxDistance = dist;
-                furthestRoom = roomId;
+                furthestRoom = room.id;
             }
         }
+        stairsRoomId = furthestRoom;
         
         // Place stairs as a 2x2 block in center of furthest room for better visibility
         for (const auto& room : rooms) {
@@ -60,9 +129,9 @@ void Dungeon::generate(int numRooms) {
                         int sx = centerX + dx;
                         int sy = centerY + dy;
                         
-                        // Ensure within room bounds
-                        if (sx < room.x + room.width && sy < room.y + room.height) {
-                            grid[sy][sx] = TileType::Exit;
+                        // Ensure within room bounds (and keep doorways of overlapping rooms)
+                        if (sx < room.x + room.width && sy < room.y + room.height && !getDoorAt(sx, sy)) {
+                            putTile(sx, sy, TileType::Exit);
                         }
                     }
                 }
@@ -73,90 +142,139 @@ void Dungeon::generate(int numRooms) {
         }
     }
     
-    std::cout << "[Dungeon] Generation complete!" << std::endl;
+    // Doors are placed, so door state is final for the walk mask
+    rebuildWalkMask();
+    connectivity.rebuild(tileMap);
 }
 
-void Dungeon::generateRooms(int numRooms) {
-    std::srand(static_cast<unsigned>(std::time(nullptr)));
-    
-    for (int i = 0; i < numRooms; i++) {
-        int x = 2 + (std::rand() % (GRID_WIDTH - 10));  // More margin
-        int y = 2 + (std::rand() % (GRID_HEIGHT - 10));
-        int w = 3 + (std::rand() % 4);
-        int h = 3 + (std::rand() % 4);
-        
-        // Ensure room fits with proper bounds checking
-        if (x + w >= GRID_WIDTH - 1) {
-            w = GRID_WIDTH - x - 2;
-        }
-        if (y + h >= GRID_HEIGHT - 1) {
-            h = GRID_HEIGHT - y - 2;
+bool Dungeon::restore(const FloorSnapshot& snapshot) {
+    if (!snapshot.isOpen()) return false;
+    const Snapshot::Header& header = snapshot.getHeader();
+    
+    // Chunks come back verbatim, walk bits included, so there is no mask to rebuild
+    tileMap.reset(header.width, header.height, header.fillTile);
+    for (int chunkY = 0; chunkY < snapshot.chunkCountY(); chunkY++) {
+        for (int chunkX = 0; chunkX < snapshot.chunkCountX(); chunkX++) {
+            if (const ChunkedTileMap::Chunk* chunk = snapshot.chunkAt(chunkX, chunkY)) {
+                tileMap.loadChunk(chunkX, chunkY, *chunk);
+            }
         }
+    }
+    tileRenderer.reset();
+    fieldOfView.reset(header.width, header.height);
+    layoutVersion++;
+    pathfinder.reset();
+    floorId = nextFloorId.fetch_add(1, std::memory_order_relaxed);
+    
+    rooms.clear();
+    roomGraph.clear();
+    sourceRoutes = RouteTree();
+    rooms.reserve(snapshot.rooms().size());
+    for (const Snapshot::Room& saved : snapshot.rooms()) {
+        rooms.emplace_back(saved.id, saved.x, saved.y, saved.width, saved.height, static_cast<TileType>(saved.type));
+        rooms.back().cleared = saved.cleared != 0;
+        roomGraph.addVertex(saved.id);
+    }
+    for (const Snapshot::Edge& edge : snapshot.edges()) {
+        roomGraph.addBidirectionalEdge(edge.roomA, edge.roomB, edge.weight);
+    }
+    roomGraph.freeze();
+    
+    // Door tiles are already in the chunks; only the list and its index are rebuilt
+    clearDoors();
+    for (const Snapshot::Door& saved : snapshot.doors()) {
+        if (!inBounds(saved.x, saved.y)) continue;
+        const int tileId = saved.y * tileMap.width() + saved.x;
+        if (doorIndex.contains(tileId)) continue;
         
-        // Ensure minimum room size
-        if (w < 3) w = 3;
-        if (h < 3) h = 3;
-        
-        TileType type = TileType::Floor;
-        if (i == 0) type = TileType::Start;
-        else if (i == numRooms - 1) type = TileType::Exit;
-        
-        Room room(i, x, y, w, h, type);
-        rooms.push_back(room);
-        roomGraph.addVertex(i);
-        
-        std::cout << "[Dungeon] Created room " << i << " at (" << x << ", " << y << ") size " << w << "x" << h << std::endl;
+        doorIndex.insert(tileId, static_cast<int>(doors.size()));
+        doors.push_back(DoorData(saved.x, saved.y, saved.roomA, saved.roomB, saved.requiresKey != 0, saved.openOnClear != 0));
+        doors.back().isOpen = saved.isOpen != 0;
     }
+    clearDoorsOpened = (header.flags & Snapshot::FLAG_CLEAR_DOORS_OPENED) != 0;
     
-    if (!rooms.empty()) {
-        startRoomId = rooms[0].id;
-        currentRoomId = startRoomId;
+    startRoomId = header.startRoomId;
+    currentRoomId = startRoomId;
+    stairsRoomId = header.stairsRoomId;
+    stairsX = header.stairsX;
+    stairsY = header.stairsY;
+    buildEntranceRoutes();
+    
+    connectivity.rebuild(tileMap);
+    return true;
+}
+
+bool Dungeon::stairsReachable() const {
+    if (rooms.size() < 2 || stairsRoomId < 0) return true;  // No stairs to reach
+    const Room& start = rooms.front();
+    return isReachable(start.x + start.width / 2, start.y + start.height / 2, stairsX, stairsY);
+}
+
+bool Dungeon::isReachable(int fromX, int fromY, int toX, int toY) const {
+    if (connectivity.needsRebuild()) {
+        connectivity.rebuild(tileMap);
     }
+    return connectivity.connected(fromX, fromY, toX, toY);
 }
 
-void Dungeon::connectRooms() {
+int Dungeon::getRegionAt(int x, int y) const {
+    if (connectivity.needsRebuild()) {
+        connectivity.rebuild(tileMap);
+    }
+    return connectivity.regionOf(x, y);
+}
+
+const FieldOfView& Dungeon::updateFieldOfView(int x, int y, int radius) const {
+    if (!fieldOfView.isCurrent(x, y, radius, layoutVersion)) {
+        // Open doors are Floor tiles, so only closed ones block sight
+        const uint32_t opaque = (1u << static_cast<unsigned>(TileType::Wall)) |
+                                (1u << static_cast<unsigned>(TileType::Empty)) |
+                                (1u << static_cast<unsigned>(TileType::Door));
+        fieldOfView.compute(tileMap, x, y, radius, opaque, layoutVersion);
+    }
+    return fieldOfView;
+}
+
+// CHANGE: 2026-10-16 - The graph gets exactly the generator's links, each of which
+// fillGrid() carves (the old extra random edges had no corridor behind them)
+void Dungeon::connectRooms(const std::vector<RoomLink>& links) {
+    for (const auto& room : rooms) {
+        roomGraph.addVertex(room.id);
+    }
+    
     // Safety check
     if (rooms.size() < 2) {
         std::cout << "[Dungeon] Not enough rooms to connect (need at least 2)" << std::endl;
-        return;
     }
     
-    // Connect rooms in sequence and add some random connections
-    for (size_t i = 0; i < rooms.size() - 1; i++) {
-        int weight = std::abs(rooms[i].x - rooms[i+1].x) + std::abs(rooms[i].y - rooms[i+1].y);
-        roomGraph.addBidirectionalEdge(rooms[i].id, rooms[i+1].id, weight);
+    for (const auto& link : links) {
+        const Room& r1 = rooms[link.a];
+        const Room& r2 = rooms[link.b];
+        int weight = std::abs(r1.x - r2.x) + std::abs(r1.y - r2.y);
+        roomGraph.addBidirectionalEdge(r1.id, r2.id, weight);
     }
     
-    // Add some random connections
-    if (rooms.size() > 3) {
-        for (size_t i = 0; i < rooms.size() / 2; i++) {
-            int r1 = std::rand() % rooms.size();
-            int r2 = std::rand() % rooms.size();
-            if (r1 != r2) {
-                int weight = std::abs(rooms[r1].x - rooms[r2].x) + std::abs(rooms[r1].y - rooms[r2].y);
-                roomGraph.addBidirectionalEdge(rooms[r1].id, rooms[r2].id, weight);
-            }
-        }
-    }
+    // Room graph is final for this floor - pack it into CSR for allocation-free queries
+    roomGraph.freeze();
 }
 
-void Dungeon::fillGrid() {
+void Dungeon::fillGrid(const std::vector<RoomLink>& links, bool carveCorridors) {
     // Fill rooms into grid
     for (const auto& room : rooms) {
-        for (int y = room.y; y < room.y + room.height && y < GRID_HEIGHT; y++) {
-            for (int x = room.x; x < room.x + room.width && x < GRID_WIDTH; x++) {
-                grid[y][x] = room.type;
+        for (int y = room.y; y < room.y + room.height && y < tileMap.height(); y++) {
+            for (int x = room.x; x < room.x + room.width && x < tileMap.width(); x++) {
+                putTile(x, y, room.type);
             }
         }
     }
     
     // CHANGE: 2025-11-11 - Clear doors before carving new ones
-    doors.clear();
+    clearDoors();
     
-    // Carve corridors between connected rooms
-    for (size_t i = 0; i + 1 < rooms.size(); i++) {
-        carveHorizontalCorridor(rooms[i], rooms[i+1]);
-        carveVerticalCorridor(rooms[i], rooms[i+1]);
+    // Carve a corridor for every link in the room graph (caves are already joined)
+    for (size_t i = 0; carveCorridors && i < links.size(); i++) {
+        carveHorizontalCorridor(rooms[links[i].a], rooms[links[i].b]);
+        carveVerticalCorridor(rooms[links[i].a], rooms[links[i].b]);
     }
     
     std::cout << "[Dungeon] Generated " << doors.size() << " doors" << std::endl;
@@ -171,9 +289,9 @@ void Dungeon::carveHorizontalCorridor(const Room& r1, const Room& r2) {
     int endX = std::max(x1, x2);
     
     for (int x = startX; x <= endX; x++) {
-        if (x >= 0 && x < GRID_WIDTH && y >= 0 && y < GRID_HEIGHT) {
-            if (grid[y][x] == TileType::Wall || grid[y][x] == TileType::Empty) {
-                grid[y][x] = TileType::Floor;
+        if (inBounds(x, y)) {
+            if (tileAt(x, y) == TileType::Wall || tileAt(x, y) == TileType::Empty) {
+                putTile(x, y, TileType::Floor);
             }
         }
     }
@@ -183,10 +301,8 @@ void Dungeon::carveHorizontalCorridor(const Room& r1, const Room& r2) {
     if (x1 < x2 && r1.x + r1.width == startX + 1) {
         int doorX = r1.x + r1.width;
         int doorY = r1.y + r1.height / 2;
-        if (doorX >= 0 && doorX < GRID_WIDTH && doorY >= 0 && doorY < GRID_HEIGHT) {
-            grid[doorY][doorX] = TileType::Door;
-            doors.push_back(DoorData(doorX, doorY, r1.id, r2.id, false, true));
-            std::cout << "[DEBUG] Door placed at (" << doorX << ", " << doorY << ") between rooms " << r1.id << " and " << r2.id << std::endl;
+        if (inBounds(doorX, doorY)) {
+            addDoor(doorX, doorY, r1.id, r2.id);
         }
     }
     
@@ -194,10 +310,8 @@ void Dungeon::carveHorizontalCorridor(const Room& r1, const Room& r2) {
     if (x2 < x1 && r2.x + r2.width == startX + 1) {
         int doorX = r2.x + r2.width;
         int doorY = r2.y + r2.height / 2;
-        if (doorX >= 0 && doorX < GRID_WIDTH && doorY >= 0 && doorY < GRID_HEIGHT) {
-            grid[doorY][doorX] = TileType::Door;
-            doors.push_back(DoorData(doorX, doorY, r1.id, r2.id, false, true));
-            std::cout << "[DEBUG] Door placed at (" << doorX << ", " << doorY << ") between rooms " << r1.id << " and " << r2.id << std::endl;
+        if (inBounds(doorX, doorY)) {
+            addDoor(doorX, doorY, r1.id, r2.id);
         }
     }
 }
@@ -211,9 +325,9 @@ void Dungeon::carveVerticalCorridor(const Room& r1, const Room& r2) {
     int endY = std::max(y1, y2);
     
     for (int y = startY; y <= endY; y++) {
-        if (x >= 0 && x < GRID_WIDTH && y >= 0 && y < GRID_HEIGHT) {
-            if (grid[y][x] == TileType::Wall || grid[y][x] == TileType::Empty) {
-                grid[y][x] = TileType::Floor;
+        if (inBounds(x, y)) {
+            if (tileAt(x, y) == TileType::Wall || tileAt(x, y) == TileType::Empty) {
+                putTile(x, y, TileType::Floor);
             }
         }
     }
@@ -223,39 +337,39 @@ void Dungeon::carveVerticalCorridor(const Room& r1, const Room& r2) {
     if (y1 < y2 && r2.y == startY) {
         int doorX = r2.x + r2.width / 2;
         int doorY = r2.y - 1;
-        if (doorX >= 0 && doorX < GRID_WIDTH && doorY >= 0 && doorY < GRID_HEIGHT) {
-            grid[doorY][doorX] = TileType::Door;
-            doors.push_back(DoorData(doorX, doorY, r1.id, r2.id, false, true));
-            std::cout << "[DEBUG] Door placed at (" << doorX << ", " << doorY << ") between rooms " << r1.id << " and " << r2.id << std::endl;
+        if (inBounds(doorX, doorY)) {
+            addDoor(doorX, doorY, r1.id, r2.id);
         }
     }
     
     if (y2 < y1 && r2.y + r2.height == endY) {
         int doorX = r2.x + r2.width / 2;
         int doorY = r2.y + r2.height;
-        if (doorX >= 0 && doorX < GRID_WIDTH && doorY >= 0 && doorY < GRID_HEIGHT) {
-            grid[doorY][doorX] = TileType::Door;
-            doors.push_back(DoorData(doorX, doorY, r1.id, r2.id, false, true));
-            std::cout << "[DEBUG] Door placed at (" << doorX << ", " << doorY << ") between rooms " << r1.id << " and " << r2.id << std::endl;
+        if (inBounds(doorX, doorY)) {
+            addDoor(doorX, doorY, r1.id, r2.id);
         }
     }
 }
 
 TileType Dungeon::getTile(int x, int y) const {
-    if (x < 0 || x >= GRID_WIDTH || y < 0 || y >= GRID_HEIGHT) {
+    if (!inBounds(x, y)) {
         return TileType::Wall;
     }
-    return grid[y][x];
+    return tileAt(x, y);
 }
 
 void Dungeon::setTile(int x, int y, TileType type) {
-    if (x >= 0 && x < GRID_WIDTH && y >= 0 && y < GRID_HEIGHT) {
-        grid[y][x] = type;
+    if (inBounds(x, y)) {
+        putTile(x, y, type);
+        updateWalkBit(x, y);
+        layoutVersion++;
+        tileRenderer.markDirty(x, y);
     }
 }
 
-bool Dungeon::isWalkable(int x, int y) const {
-    TileType tile = getTile(x, y);
+// Slow path behind the walk mask: tile class plus door state
+bool Dungeon::computeWalkable(int x, int y) const {
+    TileType tile = tileAt(x, y);
     
     // CHANGE: 2025-11-11 - Check if door is passable
     if (tile == TileType::Door) {
@@ -265,92 +379,180 @@ bool Dungeon::isWalkable(int x, int y) const {
     return tile != TileType::Empty && tile != TileType::Wall;
 }
 
+void Dungeon::updateWalkBit(int x, int y) {
+    tileMap.setWalkable(x, y, computeWalkable(x, y));
+    connectivity.tileChanged(tileMap, x, y);
+}
+
+void Dungeon::rebuildWalkMask() {
+    // Unallocated chunks are solid wall and already read as not walkable,
+    // so only the carved chunks need a pass
+    const int gridWidth = tileMap.width();
+    const int gridHeight = tileMap.height();
+    tileMap.forEachChunk([&](int chunkX, int chunkY, const ChunkedTileMap::Chunk&) {
+        const int x0 = chunkX * ChunkedTileMap::CHUNK_SIZE;
+        const int y0 = chunkY * ChunkedTileMap::CHUNK_SIZE;
+        const int x1 = std::min(x0 + ChunkedTileMap::CHUNK_SIZE, gridWidth);
+        const int y1 = std::min(y0 + ChunkedTileMap::CHUNK_SIZE, gridHeight);
+        for (int y = y0; y < y1; y++) {
+            for (int x = x0; x < x1; x++) {
+                tileMap.setWalkable(x, y, computeWalkable(x, y));
+            }
+        }
+    });
+}
+
+const FlowField& Dungeon::getFlowField(FlowGoal goal, const std::vector<std::pair<int, int>>& goalTiles) const {
+    FlowField& field = flowFields[static_cast<size_t>(goal)];
+    if (!field.isCurrent(goalTiles, layoutVersion)) {
+        field.compute(tileMap, goalTiles, layoutVersion);
+    }
+    return field;
+}
+
+const FlowField& Dungeon::getFlowField(FlowGoal goal, int goalX, int goalY) const {
+    flowGoalScratch.assign(1, {goalX, goalY});
+    return getFlowField(goal, flowGoalScratch);
+}
+
 std::pair<int, int> Dungeon::findNextMoveToPlayer(int enemyX, int enemyY, int playerX, int playerY) const {
     // If already at player position, don't move
     if (enemyX == playerX && enemyY == playerY) {
         return {enemyX, enemyY};
     }
     
-    // BFS to find shortest path to player
-    std::queue<std::pair<int, int>> frontier;
-    std::map<std::pair<int, int>, std::pair<int, int>> cameFrom;
-    
-    frontier.push({enemyX, enemyY});
-    cameFrom[{enemyX, enemyY}] = {-1, -1};  // Start has no parent
+    // One query: a targeted search touches far fewer tiles than a whole-floor flow field.
+    // Rooms are open, so jump points skip most of them.
+    return pathfinder.nextStep(tileMap, enemyX, enemyY, playerX, playerY, Pathfinder::Method::JumpPoint);
+}
+
+bool Dungeon::findPath(int fromX, int fromY, int toX, int toY, std::vector<std::pair<int, int>>& path,
+                       Pathfinder::Method method) const {
+    return pathfinder.findPath(tileMap, fromX, fromY, toX, toY, path, method);
+}
+
+std::vector<int> Dungeon::getReachableRooms(int roomId) {
+    return roomGraph.bfs(roomId);
+}
+
+// Floyd-Warshall over the room graph. Only used up to ROUTE_TABLE_MAX_ROOMS rooms: there
+// O(n^3) once per floor is cheaper than a Dijkstra per query and every lookup after that is
+// O(1). Larger floors (generated ones reach hundreds of rooms) search from one source instead.
+void Dungeon::ensureRouteTable() const {
+    if (routeTableBuilt && routeTableVersion == roomGraph.getVersion()) {
+        return;
+    }
     
-    bool found = false;
+    const int INF = std::numeric_limits<int>::max();
+    const int n = static_cast<int>(roomGraph.vertexCount());
+    routeDistance.assign(static_cast<size_t>(n) * n, INF);
+    routeNextHop.assign(static_cast<size_t>(n) * n, -1);
     
-    // BFS search
-    while (!frontier.empty() && !found) {
-        auto current = frontier.front();
-        frontier.pop();
-        
-        // Check all 4 directions (up, down, left, right)
-        std::vector<std::pair<int, int>> neighbors = {
-            {current.first, current.second - 1},  // Up
-            {current.first, current.second + 1},  // Down
-            {current.first - 1, current.second},  // Left
-            {current.first + 1, current.second}   // Right
-        };
-        
-        for (const auto& next : neighbors) {
-            // Check if already visited
-            if (cameFrom.find(next) != cameFrom.end()) {
-                continue;
+    for (int i = 0; i < n; i++) {
+        routeDistance[i * n + i] = 0;
+        routeNextHop[i * n + i] = i;
+        roomGraph.forEachNeighbor(roomGraph.vertexAt(i), [&](int neighbor, int weight) {
+            int j = roomGraph.indexOf(neighbor);
+            if (weight < routeDistance[i * n + j]) {
+                routeDistance[i * n + j] = weight;
+                routeNextHop[i * n + j] = j;
             }
-            
-            // Check if walkable
-            if (!isWalkable(next.first, next.second)) {
-                continue;
-            }
-            
-            frontier.push(next);
-            cameFrom[next] = current;
-            
-            // Found the player!
-            if (next.first == playerX && next.second == playerY) {
-                found = true;
-                break;
+        });
+    }
+    
+    for (int k = 0; k < n; k++) {
+        for (int i = 0; i < n; i++) {
+            int ik = routeDistance[i * n + k];
+            if (ik == INF) continue;
+            for (int j = 0; j < n; j++) {
+                int kj = routeDistance[k * n + j];
+                if (kj == INF) continue;
+                if (ik + kj < routeDistance[i * n + j]) {
+                    routeDistance[i * n + j] = ik + kj;
+                    routeNextHop[i * n + j] = routeNextHop[i * n + k];
+                }
             }
         }
     }
     
-    // If no path found, stay in place
-    if (!found || cameFrom.find({playerX, playerY}) == cameFrom.end()) {
-        return {enemyX, enemyY};
+    routeTableVersion = roomGraph.getVersion();
+    routeTableBuilt = true;
+    std::cout << "[Dungeon] Built room route table for " << n << " rooms" << std::endl;
+}
+
+void Dungeon::buildEntranceRoutes() {
+    entranceRoutes = roomGraph.shortestPathTree(startRoomId);
+    entranceRoutesVersion = roomGraph.getVersion();
+}
+
+const Dungeon::RouteTree& Dungeon::routesFrom(int fromIndex) const {
+    const unsigned int version = roomGraph.getVersion();
+    if (entranceRoutes.source == fromIndex && entranceRoutesVersion == version) {
+        return entranceRoutes;
     }
-    
-    // Reconstruct path from player back to enemy
-    std::pair<int, int> current = {playerX, playerY};
-    std::pair<int, int> nextMove = current;
-    
-    while (cameFrom[current].first != -1) {
-        nextMove = current;
-        current = cameFrom[current];
-        
-        // If we're one step from the enemy, return that step
-        if (current.first == enemyX && current.second == enemyY) {
-            return nextMove;
-        }
+    if (sourceRoutes.source != fromIndex || sourceRoutesVersion != version) {
+        sourceRoutes = roomGraph.shortestPathTree(roomGraph.vertexAt(fromIndex));
+        sourceRoutesVersion = version;
     }
+    return sourceRoutes;
+}
+
+int Dungeon::getRoomDistance(int fromRoom, int toRoom) const {
+    int from = roomGraph.indexOf(fromRoom);
+    int to = roomGraph.indexOf(toRoom);
+    if (from < 0 || to < 0) return std::numeric_limits<int>::max();
     
-    // Fallback: stay in place
-    return {enemyX, enemyY};
+    const int n = static_cast<int>(roomGraph.vertexCount());
+    if (from == entranceRoutes.source || n > ROUTE_TABLE_MAX_ROOMS) {
+        return routesFrom(from).distance[to];
+    }
+    ensureRouteTable();
+    return routeDistance[from * n + to];
 }
 
-std::vector<int> Dungeon::getReachableRooms(int roomId) {
-    return roomGraph.bfs(roomId);
+int Dungeon::getNextRoomOnPath(int fromRoom, int toRoom) const {
+    int from = roomGraph.indexOf(fromRoom);
+    int to = roomGraph.indexOf(toRoom);
+    if (from < 0 || to < 0) return -1;
+    
+    const int n = static_cast<int>(roomGraph.vertexCount());
+    if (from == entranceRoutes.source || n > ROUTE_TABLE_MAX_ROOMS) {
+        // Walk the tree back from the target to the room right after the source
+        const RouteTree& tree = routesFrom(from);
+        if (!tree.reaches(to)) return -1;
+        int next = to;
+        while (tree.predecessor[next] >= 0 && tree.predecessor[next] != from) {
+            next = tree.predecessor[next];
+        }
+        return roomGraph.vertexAt(next);
+    }
+    
+    ensureRouteTable();
+    int next = routeNextHop[from * n + to];
+    return next >= 0 ? roomGraph.vertexAt(next) : -1;
 }
 
-std::vector<int> Dungeon::findShortestPath(int fromRoom, int toRoom) {
-    auto distances = roomGraph.dijkstra(fromRoom);
+std::vector<int> Dungeon::findShortestPath(int fromRoom, int toRoom) const {
+    int from = roomGraph.indexOf(fromRoom);
+    int to = roomGraph.indexOf(toRoom);
+    if (from < 0 || to < 0) return {};  // Unknown room
+    
+    const int n = static_cast<int>(roomGraph.vertexCount());
+    if (from == entranceRoutes.source || n > ROUTE_TABLE_MAX_ROOMS) {
+        return roomGraph.pathTo(routesFrom(from), toRoom);
+    }
+    
     std::vector<int> path;
+    if (getNextRoomOnPath(fromRoom, toRoom) < 0) {
+        return path;  // Unreachable
+    }
     
-    // Simple path reconstruction (just return rooms in distance order)
-    for (const auto& pair : distances) {
-        if (pair.second < std::numeric_limits<int>::max()) {
-            path.push_back(pair.first);
-        }
+    // Follow next hops; the route table is already built by the check above
+    int current = fromRoom;
+    path.push_back(current);
+    while (current != toRoom) {
+        current = getNextRoomOnPath(current, toRoom);
+        path.push_back(current);
     }
     
     return path;
@@ -389,146 +591,58 @@ void Dungeon::render(sf::RenderWindow& window, float tileSize, int currentFloor)
     // Debug: Verify grid size at render time
     static bool debugPrinted = false;
     if (!debugPrinted) {
-        std::cout << "[Dungeon] Rendering grid: " << GRID_WIDTH << "x" << GRID_HEIGHT 
-                  << " (pixels: " << (GRID_WIDTH * tileSize) << "x" << (GRID_HEIGHT * tileSize) << ")" << std::endl;
+        std::cout << "[Dungeon] Rendering grid: " << getWidth() << "x" << getHeight() 
+                  << " (pixels: " << (getWidth() * tileSize) << "x" << (getHeight() * tileSize) << ")" << std::endl;
         std::cout << "[Dungeon] Current floor: " << currentFloor << std::endl;
         debugPrinted = true;
     }
     
-    for (int y = 0; y < GRID_HEIGHT; y++) {
-        for (int x = 0; x < GRID_WIDTH; x++) {
-            sf::Texture* texture = nullptr;
-            sf::Color fallbackColor;
-            
-            // ═══════════════════════════════════════════════════════════════════════
-            // DEBTS IN THE DEPTHS TILE RENDERING - Individual PNG/GIF assets
-            // ═══════════════════════════════════════════════════════════════════════
-            
-            switch (grid[y][x]) {
-                case TileType::Empty:
-                    fallbackColor = sf::Color(15, 15, 20);  // Dark void
-                    break;
-                case TileType::Wall:
-                    texture = AssetManager::getInstance().getTexture("wall");
-                    fallbackColor = sf::Color(60, 60, 70);  // Stone gray
-                    break;
-                case TileType::Floor: {
-                    // Randomize floor tile variant based on position (deterministic)
-                    int variant = (x * 7 + y * 13) % 5;  // 0-4 for 5 variants
-                    
-                    // Choose floor type based on current floor level
-                    std::string floorKey;
-                    if (currentFloor <= 3) {
-                        // Floors 1-3: Mostly Brick (cave-like)
-                        floorKey = (variant == 0) ? "floor" : "floor";  // All brick
-                    } else if (currentFloor <= 6) {
-                        // Floors 4-6: Mix of Brick and Rock (rocky cavern)
-                        floorKey = (variant < 2) ? "floor" : "floor_variant_2";  // Brick or Rock
-                    } else {
-                        // Floors 7-10: Brimstone (hellish deep dungeon)
-                        floorKey = (variant < 3) ? "floor_variant_1" : "floor_variant_2";  // Brimstone or Rock
-                    }
-                    
-                    texture = AssetManager::getInstance().getTexture(floorKey);
-                    fallbackColor = sf::Color(80, 70, 60);  // Brown floor
-                    break;
-                }
-                case TileType::Start:
-                    texture = AssetManager::getInstance().getTexture("stairs_down");
-                    fallbackColor = sf::Color(50, 100, 200);  // Bright blue
-                    break;
-                case TileType::Exit:
-                    texture = AssetManager::getInstance().getTexture("stairs_up");
-                    fallbackColor = sf::Color(255, 200, 50);  // Golden exit
-                    break;
-                case TileType::Door:
-                    texture = AssetManager::getInstance().getTexture("door_closed");
-                    fallbackColor = sf::Color(150, 120, 60);  // Gold trim
-                    break;
-                case TileType::Treasure:
-                    texture = AssetManager::getInstance().getTexture("chest");
-                    fallbackColor = sf::Color(255, 215, 0);  // Gold
-                    break;
-                case TileType::Enemy:
-                    // Enemy tiles use randomized floor
-                    int variant = (x * 7 + y * 13) % 5;
-                    std::string floorKey = (variant == 0) ? "floor" : 
-                                          ("floor_variant_" + std::to_string(variant));
-                    texture = AssetManager::getInstance().getTexture(floorKey);
-                    fallbackColor = sf::Color(120, 40, 40);  // Dark red
-                    break;
-            }
-            
-            // Draw texture if available
-            bool drawn = false;
-
-            if (texture) {
-                sf::Sprite tileSprite(*texture);
-                tileSprite.setPosition(sf::Vector2f(x * tileSize, y * tileSize));
-                
-                // Scale to fit tile size (DebtsInTheDepths sprites may vary in size)
-                float scaleX = tileSize / texture->getSize().x;
-                float scaleY = tileSize / texture->getSize().y;
-                tileSprite.setScale(sf::Vector2f(scaleX, scaleY));
-                
-                window.draw(tileSprite);
-                drawn = true;
-                
-                // ✨ Add sparkle effect on stairs for visual enhancement
-                if (grid[y][x] == TileType::Start || grid[y][x] == TileType::Exit) {
-                    sf::Texture* sparkleTexture = AssetManager::getInstance().getTexture("effect_sparkle");
-                    if (sparkleTexture) {
-                        sf::Sprite sparkle(*sparkleTexture);
-                        sparkle.setPosition(sf::Vector2f(x * tileSize, y * tileSize));
-                        
-                        float sparkleScale = tileSize / sparkleTexture->getSize().x;
-                        sparkle.setScale(sf::Vector2f(sparkleScale, sparkleScale));
-                        
-                        // Make sparkles semi-transparent for overlay effect
-                        sparkle.setColor(sf::Color(255, 255, 255, 180));
-                        
-                        window.draw(sparkle);
-                    }
-                }
-            }
-
-            int tileIndexToUse = -1;
-
-            // ═══════════════════════════════════════════════════════════════════════
-            // TILE MAPPING - No longer using Kenney spritesheet, using individual assets
-            // ═══════════════════════════════════════════════════════════════════════
+    // CHANGE: 2026-10-16 - Tiles come from cached per-chunk vertex arrays (TileMapRenderer)
+    // instead of one sprite or rectangle per tile; only chunks in the current view are drawn
+    tileRenderer.draw(window, tileMap, tileSize, currentFloor);
+}
 
-            if (!drawn) {
-                // Fallback to colored rectangle
-                sf::RectangleShape tile(sf::Vector2f(tileSize, tileSize));
-                tile.setPosition(sf::Vector2f(x * tileSize, y * tileSize));
-                tile.setFillColor(fallbackColor);
-                
-                if (grid[y][x] != TileType::Empty) {
-                    tile.setOutlineThickness(0.5f);
-                    tile.setOutlineColor(sf::Color(30, 30, 35));
-                }
-                window.draw(tile);
-            }
-        }
+void Dungeon::renderFog(sf::RenderWindow& window, float tileSize) const {
+    if (fieldOfView.isComputed()) {
+        tileRenderer.drawFog(window, fieldOfView, tileSize);
     }
 }
 
 // CHANGE: 2025-11-11 - Door management implementation
+void Dungeon::addDoor(int x, int y, int roomA, int roomB) {
+    const int tileId = y * tileMap.width() + x;
+    if (doorIndex.contains(tileId)) return;  // Two corridors ending at the same doorway
+    
+    putTile(x, y, TileType::Door);
+    doorIndex.insert(tileId, static_cast<int>(doors.size()));
+    doors.push_back(DoorData(x, y, roomA, roomB, false, true));
+    std::cout << "[DEBUG] Door placed at (" << x << ", " << y << ") between rooms " << roomA << " and " << roomB << std::endl;
+}
+
+void Dungeon::clearDoors() {
+    doors.clear();
+    doorIndex.clear();
+    clearDoorsOpened = false;
+}
+
 DoorData* Dungeon::getDoorAt(int x, int y) {
-    for (auto& door : doors) {
-        if (door.x == x && door.y == y) {
-            return &door;
-        }
-    }
-    return nullptr;
+    return const_cast<DoorData*>(static_cast<const Dungeon*>(this)->getDoorAt(x, y));
+}
+
+const DoorData* Dungeon::getDoorAt(int x, int y) const {
+    if (!inBounds(x, y)) return nullptr;
+    const int* index = doorIndex.find(y * tileMap.width() + x);
+    return index ? &doors[*index] : nullptr;
 }
 
 void Dungeon::openDoor(int x, int y) {
     DoorData* door = getDoorAt(x, y);
     if (door && !door->isOpen) {
         door->isOpen = true;
-        grid[y][x] = TileType::Floor;  // Make passable
+        putTile(x, y, TileType::Floor);  // Make passable
+        updateWalkBit(x, y);
+        layoutVersion++;
+        tileRenderer.markDirty(x, y);
         std::cout << "[DEBUG] Door opened at (" << x << ", " << y << ")" << std::endl;
     }
 }
@@ -537,18 +651,18 @@ void Dungeon::closeDoor(int x, int y) {
     DoorData* door = getDoorAt(x, y);
     if (door && door->isOpen) {
         door->isOpen = false;
-        grid[y][x] = TileType::Door;  // Make impassable
+        putTile(x, y, TileType::Door);  // Make impassable
+        updateWalkBit(x, y);
+        layoutVersion++;
+        tileRenderer.markDirty(x, y);
         std::cout << "[DEBUG] Door closed at (" << x << ", " << y << ")" << std::endl;
     }
 }
 
 bool Dungeon::canPassDoor(int x, int y) const {
-    for (const auto& door : doors) {
-        if (door.x == x && door.y == y) {
-            return door.isOpen || !door.requiresKey;
-        }
-    }
-    return true;  // No door here, can pass
+    const DoorData* door = getDoorAt(x, y);
+    if (!door) return true;  // No door here, can pass
+    return door->isOpen || !door->requiresKey;
 }
 
 void Dungeon::checkRoomClear(int roomId, int enemyCount) {
@@ -566,3 +680,17 @@ void Dungeon::checkRoomClear(int roomId, int enemyCount) {
         }
     }
 }
+
+int Dungeon::openClearableDoors() {
+    if (clearDoorsOpened) return 0;
+    clearDoorsOpened = true;
+    
+    int opened = 0;
+    for (const auto& door : doors) {
+        if (door.openOnClear && !door.isOpen) {
+            openDoor(door.x, door.y);
+            opened++;
+        }
+    }
+    return opened;
+}
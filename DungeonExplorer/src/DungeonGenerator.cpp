@@ -0,0 +1,457 @@
+// CHANGE: 2026-10-16 - Built-in room placers and connectors (see DungeonGenerator.h)
+
+#include "DungeonGenerator.h"
+#include "Dungeon.h"
+#include "CaveGenerator.h"
+#include "DataStructures/Heap.h"
+#include "DataStructures/HashTable.h"
+#include "DataStructures/DisjointSet.h"
+#include <iostream>
+#include <algorithm>
+#include <functional>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace {
+
+// Same room sizes as the original generator
+const int ROOM_MIN = 3;
+const int ROOM_MAX = 6;
+
+struct Region {
+    int x, y, width, height;
+    int area() const { return width * height; }
+};
+
+// Room rectangles grown by 'gap' tiles overlap
+bool overlaps(const Room& r, int x, int y, int w, int h, int gap) {
+    return x - gap < r.x + r.width && r.x < x + w + gap &&
+           y - gap < r.y + r.height && r.y < y + h + gap;
+}
+
+// --- Delaunay triangulation (Bowyer-Watson, Bourke's x-sorted sweep) ---
+
+struct Point {
+    double x, y;
+};
+
+struct Triangle {
+    int a, b, c;
+    double cx, cy, r2;  // Circumcircle
+};
+
+void setCircumcircle(const std::vector<Point>& points, Triangle& t) {
+    const Point& A = points[t.a];
+    const Point& B = points[t.b];
+    const Point& C = points[t.c];
+    const double d = 2.0 * (A.x * (B.y - C.y) + B.x * (C.y - A.y) + C.x * (A.y - B.y));
+    if (std::abs(d) < 1e-12) {
+        // Collinear: treat the circle as covering everything so the next point removes it
+        t.cx = A.x;
+        t.cy = A.y;
+        t.r2 = std::numeric_limits<double>::infinity();
+        return;
+    }
+    const double a2 = A.x * A.x + A.y * A.y;
+    const double b2 = B.x * B.x + B.y * B.y;
+    const double c2 = C.x * C.x + C.y * C.y;
+    t.cx = (a2 * (B.y - C.y) + b2 * (C.y - A.y) + c2 * (A.y - B.y)) / d;
+    t.cy = (a2 * (C.x - B.x) + b2 * (A.x - C.x) + c2 * (B.x - A.x)) / d;
+    t.r2 = (A.x - t.cx) * (A.x - t.cx) + (A.y - t.cy) * (A.y - t.cy);
+}
+
+// Edges (a < b) of the triangulation of 'points', which must have distinct positions.
+// Points are inserted in x order; a triangle whose circumcircle lies entirely left of the
+// current point can never be broken again and is retired, which keeps the active list short.
+void delaunayEdges(std::vector<Point> points, std::vector<std::pair<int, int>>& edges) {
+    edges.clear();
+    const int n = static_cast<int>(points.size());
+    if (n < 2) return;
+    if (n == 2) {
+        edges.push_back({0, 1});
+        return;
+    }
+    
+    std::vector<int> order(n);
+    for (int i = 0; i < n; i++) order[i] = i;
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return points[a].x < points[b].x || (points[a].x == points[b].x && points[a].y < points[b].y);
+    });
+    
+    // Super triangle enclosing every point (vertices n, n + 1, n + 2)
+    double minX = points[0].x, maxX = minX, minY = points[0].y, maxY = minY;
+    for (const Point& p : points) {
+        minX = std::min(minX, p.x);
+        maxX = std::max(maxX, p.x);
+        minY = std::min(minY, p.y);
+        maxY = std::max(maxY, p.y);
+    }
+    const double span = std::max({maxX - minX, maxY - minY, 1.0});
+    const double midX = (minX + maxX) / 2.0;
+    const double midY = (minY + maxY) / 2.0;
+    points.push_back({midX - 20.0 * span, midY - span});
+    points.push_back({midX, midY + 20.0 * span});
+    points.push_back({midX + 20.0 * span, midY - span});
+    
+    std::vector<Triangle> active;
+    std::vector<Triangle> retired;
+    std::vector<std::pair<int, int>> hole;
+    
+    Triangle super{n, n + 1, n + 2, 0.0, 0.0, 0.0};
+    setCircumcircle(points, super);
+    active.push_back(super);
+    
+    for (int i : order) {
+        const Point& p = points[i];
+        hole.clear();
+        
+        for (size_t t = 0; t < active.size();) {
+            const Triangle& tri = active[t];
+            const double dx = p.x - tri.cx;
+            if (dx > 0.0 && dx * dx > tri.r2) {
+                retired.push_back(tri);
+            } else {
+                const double dy = p.y - tri.cy;
+                if (dx * dx + dy * dy > tri.r2 * (1.0 + 1e-9)) {
+                    t++;
+                    continue;
+                }
+                // p is inside: the triangle's edges bound the hole p is connected to
+                hole.push_back(std::minmax(tri.a, tri.b));
+                hole.push_back(std::minmax(tri.b, tri.c));
+                hole.push_back(std::minmax(tri.c, tri.a));
+            }
+            active[t] = active.back();
+            active.pop_back();
+        }
+        
+        // An edge shared by two removed triangles is inside the hole
+        std::sort(hole.begin(), hole.end());
+        for (size_t e = 0; e < hole.size(); e++) {
+            if (e + 1 < hole.size() && hole[e] == hole[e + 1]) {
+                while (e + 1 < hole.size() && hole[e] == hole[e + 1]) e++;
+                continue;
+            }
+            Triangle tri{hole[e].first, hole[e].second, i, 0.0, 0.0, 0.0};
+            setCircumcircle(points, tri);
+            active.push_back(tri);
+        }
+    }
+    
+    auto collect = [&](const std::vector<Triangle>& triangles) {
+        for (const Triangle& tri : triangles) {
+            const int v[3] = {tri.a, tri.b, tri.c};
+            for (int k = 0; k < 3; k++) {
+                const int a = v[k];
+                const int b = v[(k + 1) % 3];
+                if (a < n && b < n) edges.push_back(std::minmax(a, b));
+            }
+        }
+    };
+    collect(active);
+    collect(retired);
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+}
+
+}  // namespace
+
+DungeonGenerator::DungeonGenerator(std::string name, std::unique_ptr<RoomPlacer> placer,
+                                   std::unique_ptr<RoomConnector> connector, std::unique_ptr<TerrainStage> terrain)
+    : name(std::move(name)), placer(std::move(placer)), connector(std::move(connector)), terrain(std::move(terrain)) {}
+
+std::unique_ptr<DungeonGenerator> DungeonGenerator::create(std::string_view name) {
+    if (name == "classic") {
+        return std::make_unique<DungeonGenerator>("classic", std::make_unique<ClassicPlacer>(),
+                                                  std::make_unique<ChainConnector>());
+    }
+    if (name == "bsp") {
+        return std::make_unique<DungeonGenerator>("bsp", std::make_unique<BspPlacer>(),
+                                                  std::make_unique<DelaunayMstConnector>());
+    }
+    if (name == "scatter") {
+        return std::make_unique<DungeonGenerator>("scatter", std::make_unique<ScatterPlacer>(),
+                                                  std::make_unique<DelaunayMstConnector>());
+    }
+    if (name == "cave") {
+        return std::make_unique<DungeonGenerator>("cave", std::make_unique<ScatterPlacer>(true),
+                                                  std::make_unique<DelaunayMstConnector>(),
+                                                  std::make_unique<CaveTerrain>());
+    }
+    return nullptr;
+}
+
+void DungeonGenerator::generate(const GenerationParams& params, RandomStream& rng, ChunkedTileMap& map,
+                                std::vector<Room>& rooms, std::vector<RoomLink>& links) const {
+    if (terrain) {
+        terrain->carve(params, rng, map);
+    }
+    placer->place(params, rng, map, rooms);
+    connector->connect(rooms, rng, links);
+    
+    std::cout << "[DungeonGenerator] " << name << ": " << rooms.size() << " rooms, "
+              << links.size() << " corridors" << std::endl;
+}
+
+void CaveTerrain::carve(const GenerationParams& params, RandomStream& rng, ChunkedTileMap& map) const {
+    // The solid border eats into small floors, so they start a little more open
+    const bool small = params.width * params.height < 64 * 64;
+    CaveGenerator cave(smoothingPasses, small ? 6 : 7);
+    cave.generate(params.width, params.height, rng);
+    cave.writeTo(map, static_cast<uint8_t>(TileType::Floor));
+    
+    std::cout << "[DungeonGenerator] Cave: " << cave.getOpenCount() << " open tiles, "
+              << cave.getPocketCount() << " pockets filled" << std::endl;
+}
+
+void ClassicPlacer::place(const GenerationParams& params, RandomStream& rng, const ChunkedTileMap&,
+                          std::vector<Room>& rooms) const {
+    rooms.clear();
+    
+    for (int i = 0; i < params.numRooms; i++) {
+        int x = 2 + static_cast<int>(rng.below(params.width - 10));  // More margin
+        int y = 2 + static_cast<int>(rng.below(params.height - 10));
+        int w = ROOM_MIN + static_cast<int>(rng.below(ROOM_MAX - ROOM_MIN + 1));
+        int h = ROOM_MIN + static_cast<int>(rng.below(ROOM_MAX - ROOM_MIN + 1));
+        
+        // Ensure room fits with proper bounds checking
+        if (x + w >= params.width - 1) {
+            w = params.width - x - 2;
+        }
+        if (y + h >= params.height - 1) {
+            h = params.height - y - 2;
+        }
+        
+        // Ensure minimum room size
+        if (w < ROOM_MIN) w = ROOM_MIN;
+        if (h < ROOM_MIN) h = ROOM_MIN;
+        
+        rooms.push_back(Room(i, x, y, w, h));
+    }
+}
+
+void BspPlacer::place(const GenerationParams& params, RandomStream& rng, const ChunkedTileMap&,
+                      std::vector<Room>& rooms) const {
+    rooms.clear();
+    if (params.numRooms <= 0) return;
+    
+    // A region holds one room plus a 1-tile wall on every side, so neighbouring rooms
+    // always have at least two tiles of wall between them
+    const int MIN_REGION = ROOM_MIN + 2;
+    
+    std::vector<Region> regions;
+    regions.push_back({0, 0, params.width, params.height});
+    
+    // Largest region on top: always split the biggest one so rooms spread evenly
+    Heap<std::pair<int, int>, std::less<std::pair<int, int>>, 4, NoTrace> largest;
+    largest.insert({regions[0].area(), 0});
+    std::vector<int> leaves;  // Regions too small to split again
+    
+    while (!largest.isEmpty() && leaves.size() + largest.size() < static_cast<size_t>(params.numRooms)) {
+        const int index = largest.extractTop().second;
+        const Region region = regions[index];
+        
+        const bool canCutX = region.width >= 2 * MIN_REGION;
+        const bool canCutY = region.height >= 2 * MIN_REGION;
+        if (!canCutX && !canCutY) {
+            leaves.push_back(index);
+            continue;
+        }
+        
+        // Cut across the longer side (random when roughly square) so regions stay compact
+        bool cutX = canCutX;
+        if (canCutX && canCutY) {
+            if (region.width * 4 > region.height * 5) cutX = true;
+            else if (region.height * 4 > region.width * 5) cutX = false;
+            else cutX = rng.below(2) == 0;
+        }
+        
+        if (cutX) {
+            const int cut = rng.range(MIN_REGION, region.width - MIN_REGION);
+            regions[index] = {region.x, region.y, cut, region.height};
+            regions.push_back({region.x + cut, region.y, region.width - cut, region.height});
+        } else {
+            const int cut = rng.range(MIN_REGION, region.height - MIN_REGION);
+            regions[index] = {region.x, region.y, region.width, cut};
+            regions.push_back({region.x, region.y + cut, region.width, region.height - cut});
+        }
+        const int added = static_cast<int>(regions.size()) - 1;
+        largest.insert({regions[index].area(), index});
+        largest.insert({regions[added].area(), added});
+    }
+    while (!largest.isEmpty()) {
+        leaves.push_back(largest.extractTop().second);
+    }
+    
+    // Region 0 always keeps the top-left corner, so the entrance room starts there
+    std::sort(leaves.begin(), leaves.end());
+    
+    rooms.reserve(leaves.size());
+    for (int index : leaves) {
+        const Region& region = regions[index];
+        const int w = rng.range(ROOM_MIN, std::min(ROOM_MAX, region.width - 2));
+        const int h = rng.range(ROOM_MIN, std::min(ROOM_MAX, region.height - 2));
+        const int x = region.x + 1 + static_cast<int>(rng.below(static_cast<uint32_t>(region.width - 2 - w + 1)));
+        const int y = region.y + 1 + static_cast<int>(rng.below(static_cast<uint32_t>(region.height - 2 - h + 1)));
+        rooms.push_back(Room(static_cast<int>(rooms.size()), x, y, w, h));
+    }
+}
+
+void ScatterPlacer::place(const GenerationParams& params, RandomStream& rng, const ChunkedTileMap& terrain,
+                          std::vector<Room>& rooms) const {
+    rooms.clear();
+    if (params.numRooms <= 0) return;
+    
+    // A room grown by its 1-tile gap is at most ROOM_MAX + 2 wide, so with this cell size
+    // every test touches at most 2x2 cells
+    const int CELL = ROOM_MAX + 2;
+    const int cellsX = params.width / CELL + 1;
+    HashTable<int, std::vector<int>, NoTrace> cells;  // Cell -> rooms covering it
+    cells.reserve(static_cast<size_t>(params.numRooms) * 2);
+    
+    auto onGround = [&](int x, int y, int w, int h) {
+        for (int ty = y; ty < y + h; ty++) {
+            for (int tx = x; tx < x + w; tx++) {
+                if (terrain.get(tx, ty) != static_cast<uint8_t>(TileType::Floor)) return false;
+            }
+        }
+        return true;
+    };
+    
+    auto cellRange = [&](int x, int y, int w, int h, auto&& visit) {
+        for (int cy = std::max(y, 0) / CELL; cy <= (y + h - 1) / CELL; cy++) {
+            for (int cx = std::max(x, 0) / CELL; cx <= (x + w - 1) / CELL; cx++) {
+                if (!visit(cy * cellsX + cx)) return false;
+            }
+        }
+        return true;
+    };
+    
+    const int attempts = params.numRooms * attemptsPerRoom;
+    for (int attempt = 0; attempt < attempts && static_cast<int>(rooms.size()) < params.numRooms; attempt++) {
+        const int w = rng.range(ROOM_MIN, ROOM_MAX);
+        const int h = rng.range(ROOM_MIN, ROOM_MAX);
+        if (w > params.width - 2 || h > params.height - 2) continue;
+        const int x = 1 + static_cast<int>(rng.below(static_cast<uint32_t>(params.width - 1 - w)));
+        const int y = 1 + static_cast<int>(rng.below(static_cast<uint32_t>(params.height - 1 - h)));
+        
+        // Reject if any room sharing a cell with the grown rectangle is within one tile
+        const bool clear = cellRange(x - 1, y - 1, w + 2, h + 2, [&](int cell) {
+            const std::vector<int>* occupants = cells.find(cell);
+            if (!occupants) return true;
+            for (int id : *occupants) {
+                if (overlaps(rooms[id], x, y, w, h, 1)) return false;
+            }
+            return true;
+        });
+        if (!clear || (onOpenGround && !onGround(x, y, w, h))) continue;
+        
+        const int id = static_cast<int>(rooms.size());
+        rooms.push_back(Room(id, x, y, w, h));
+        cellRange(x, y, w, h, [&](int cell) {
+            cells[cell].push_back(id);
+            return true;
+        });
+    }
+}
+
+void ChainConnector::connect(const std::vector<Room>& rooms, RandomStream& rng, std::vector<RoomLink>& links) const {
+    links.clear();
+    if (rooms.size() < 2) return;
+    
+    // Connect rooms in sequence and add some random connections
+    for (size_t i = 0; i + 1 < rooms.size(); i++) {
+        links.push_back({static_cast<int>(i), static_cast<int>(i + 1)});
+    }
+    
+    if (rooms.size() > 3) {
+        for (size_t i = 0; i < rooms.size() / 2; i++) {
+            int r1 = static_cast<int>(rng.below(static_cast<uint32_t>(rooms.size())));
+            int r2 = static_cast<int>(rng.below(static_cast<uint32_t>(rooms.size())));
+            if (r1 != r2) {
+                links.push_back({r1, r2});
+            }
+        }
+    }
+}
+
+void DelaunayMstConnector::connect(const std::vector<Room>& rooms, RandomStream& rng, std::vector<RoomLink>& links) const {
+    links.clear();
+    const int n = static_cast<int>(rooms.size());
+    if (n < 2) return;
+    
+    struct Candidate {
+        int64_t weight;  // Squared centre distance
+        int a, b;
+        bool delaunay;
+    };
+    std::vector<Candidate> candidates;
+    
+    auto centreX = [&](int i) { return rooms[i].x + rooms[i].width / 2; };
+    auto centreY = [&](int i) { return rooms[i].y + rooms[i].height / 2; };
+    auto addCandidate = [&](int a, int b, bool delaunay) {
+        const int64_t dx = centreX(a) - centreX(b);
+        const int64_t dy = centreY(a) - centreY(b);
+        candidates.push_back({dx * dx + dy * dy, std::min(a, b), std::max(a, b), delaunay});
+    };
+    
+    // Rooms in centre order. Neighbours in this order are always candidates: they keep the
+    // candidate graph connected even if the triangulation degenerates, and link rooms that
+    // share a centre (only one of them is triangulated).
+    std::vector<int> order(n);
+    for (int i = 0; i < n; i++) order[i] = i;
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return centreX(a) < centreX(b) || (centreX(a) == centreX(b) && centreY(a) < centreY(b));
+    });
+    
+    std::vector<Point> points;
+    std::vector<int> pointRoom;
+    points.reserve(n);
+    pointRoom.reserve(n);
+    for (int k = 0; k < n; k++) {
+        if (k > 0) {
+            addCandidate(order[k - 1], order[k], false);
+            if (centreX(order[k - 1]) == centreX(order[k]) && centreY(order[k - 1]) == centreY(order[k])) {
+                continue;
+            }
+        }
+        points.push_back({static_cast<double>(centreX(order[k])), static_cast<double>(centreY(order[k]))});
+        pointRoom.push_back(order[k]);
+    }
+    
+    std::vector<std::pair<int, int>> triangulation;
+    delaunayEdges(std::move(points), triangulation);
+    for (const auto& edge : triangulation) {
+        addCandidate(pointRoom[edge.first], pointRoom[edge.second], true);
+    }
+    
+    // Merge duplicates (keeping the Delaunay flag), then sort by length for Kruskal
+    std::sort(candidates.begin(), candidates.end(), [](const Candidate& l, const Candidate& r) {
+        return l.a < r.a || (l.a == r.a && (l.b < r.b || (l.b == r.b && l.delaunay > r.delaunay)));
+    });
+    candidates.erase(std::unique(candidates.begin(), candidates.end(), [](const Candidate& l, const Candidate& r) {
+        return l.a == r.a && l.b == r.b;
+    }), candidates.end());
+    std::sort(candidates.begin(), candidates.end(), [](const Candidate& l, const Candidate& r) {
+        return l.weight < r.weight || (l.weight == r.weight && (l.a < r.a || (l.a == r.a && l.b < r.b)));
+    });
+    
+    // Kruskal: shortest candidates first, skipping any that would close a cycle
+    DisjointSet<NoTrace> components(static_cast<size_t>(n));
+    std::vector<const Candidate*> spare;
+    for (const Candidate& candidate : candidates) {
+        if (components.unite(candidate.a, candidate.b)) {
+            links.push_back({candidate.a, candidate.b});
+        } else if (candidate.delaunay) {
+            spare.push_back(&candidate);
+        }
+    }
+    
+    // Some unused Delaunay edges go back in so the floor has loops, not just dead ends
+    for (const Candidate* candidate : spare) {
+        if (rng.chance(loopPercent)) {
+            links.push_back({candidate->a, candidate->b});
+        }
+    }
+}
@@ -3,7 +3,9 @@
 
 #include "Enemy.h"
 #include "AssetManager.h"
+#include "FieldOfView.h"
 #include <iostream>
+#include <algorithm>
 
 EnemyManager::EnemyManager() : nextEnemyId(0) {
 }
@@ -81,6 +83,16 @@ void EnemyManager::removeDeadEnemies() {
     }
 }
 
+void EnemyManager::restore(std::vector<EnemyData> saved) {
+    enemies = std::move(saved);
+    turnQueue.clear();  // Held pointers into the old list
+    
+    nextEnemyId = 0;
+    for (const auto& enemy : enemies) {
+        nextEnemyId = std::max(nextEnemyId, enemy.id + 1);
+    }
+}
+
 void EnemyManager::initializeTurnQueue() {
     turnQueue.clear();
     
@@ -125,8 +137,12 @@ void EnemyManager::update(float deltaTime) {
     // Update enemy logic
 }
 
-void EnemyManager::render(sf::RenderWindow& window, float tileSize) const {
+void EnemyManager::render(sf::RenderWindow& window, float tileSize, const TileRect& visible,
+                          const FieldOfView* sight) const {
     for (const auto& enemy : enemies) {
+        if (!visible.contains(enemy.x, enemy.y)) continue;  // Off camera
+        if (sight && sight->isComputed() && !sight->isVisible(enemy.x, enemy.y)) continue;  // Out of sight
+        
         // Draw shadow first (below character)
         sf::CircleShape shadow(10.0f);
         shadow.setFillColor(sf::Color(0, 0, 0, 80));
@@ -0,0 +1,161 @@
+// CHANGE: 2026-10-16 - Symmetric shadowcasting (see FieldOfView.h)
+
+#include "FieldOfView.h"
+#include "ChunkedTileMap.h"
+#include <algorithm>
+
+namespace {
+    // Floor and ceiling of a / b for b > 0
+    int floorDiv(int a, int b) {
+        return a >= 0 ? a / b : -((-a + b - 1) / b);
+    }
+
+    int ceilDiv(int a, int b) {
+        return a >= 0 ? (a + b - 1) / b : -(-a / b);
+    }
+}
+
+FieldOfView::FieldOfView()
+    : width(0), height(0), wordsPerRow(0), computed(false), lastX(0), lastY(0), lastRadius(0), version(0),
+      exploredVersion(0), visibleCount(0), boxX0(0), boxY0(0), boxX1(-1), boxY1(-1) {}
+
+void FieldOfView::reset(int newWidth, int newHeight) {
+    width = std::max(newWidth, 0);
+    height = std::max(newHeight, 0);
+    wordsPerRow = (width + 63) / 64;
+    visible.assign(static_cast<size_t>(wordsPerRow) * height, 0);
+    explored.assign(visible.size(), 0);
+    computed = false;
+    exploredVersion++;
+    visibleCount = 0;
+    boxX0 = 0;
+    boxY0 = 0;
+    boxX1 = -1;
+    boxY1 = -1;
+}
+
+void FieldOfView::clearBox() {
+    if (boxX1 < boxX0 || boxY1 < boxY0) return;
+
+    const int firstWord = boxX0 >> 6;
+    const int lastWord = boxX1 >> 6;
+    for (int y = boxY0; y <= boxY1; y++) {
+        uint64_t* row = &visible[static_cast<size_t>(y) * wordsPerRow];
+        std::fill(row + firstWord, row + lastWord + 1, 0);
+    }
+}
+
+void FieldOfView::reveal(int x, int y) {
+    uint64_t& word = visible[static_cast<size_t>(y) * wordsPerRow + (x >> 6)];
+    const uint64_t bit = uint64_t(1) << (x & 63);
+    visibleCount += (word & bit) == 0;
+    word |= bit;
+}
+
+void FieldOfView::compute(const ChunkedTileMap& map, int originX, int originY, int radius,
+                          uint32_t opaqueTiles, unsigned int layoutVersion) {
+    if (map.width() != width || map.height() != height) {
+        reset(map.width(), map.height());
+    }
+
+    clearBox();
+    visibleCount = 0;
+    computed = true;
+    lastX = originX;
+    lastY = originY;
+    lastRadius = radius;
+    version = layoutVersion;
+    radius = std::max(radius, 0);
+
+    if (!inBounds(originX, originY)) {
+        boxX1 = boxX0 - 1;
+        return;
+    }
+
+    boxX0 = std::max(originX - radius, 0);
+    boxY0 = std::max(originY - radius, 0);
+    boxX1 = std::min(originX + radius, width - 1);
+    boxY1 = std::min(originY + radius, height - 1);
+
+    reveal(originX, originY);
+    for (int quadrant = 0; quadrant < 4; quadrant++) {
+        scanQuadrant(map, quadrant, originX, originY, radius, opaqueTiles);
+    }
+
+    // Fold the new sight into the explored layer, word by word over the box
+    const int firstWord = boxX0 >> 6;
+    const int lastWord = boxX1 >> 6;
+    bool exploredNew = false;
+    for (int y = boxY0; y <= boxY1; y++) {
+        const size_t rowStart = static_cast<size_t>(y) * wordsPerRow;
+        for (int k = firstWord; k <= lastWord; k++) {
+            const uint64_t seen = visible[rowStart + k];
+            exploredNew |= (seen & ~explored[rowStart + k]) != 0;
+            explored[rowStart + k] |= seen;
+        }
+    }
+    if (exploredNew) {
+        exploredVersion++;
+    }
+}
+
+void FieldOfView::scanQuadrant(const ChunkedTileMap& map, int quadrant, int originX, int originY, int radius,
+                               uint32_t opaqueTiles) {
+    // Quadrant-local (depth, col) to map coordinates: north, east, south, west
+    auto tileX = [&](int depth, int col) {
+        return quadrant == 1 ? originX + depth : quadrant == 3 ? originX - depth : originX + col;
+    };
+    auto tileY = [&](int depth, int col) {
+        return quadrant == 0 ? originY - depth : quadrant == 2 ? originY + depth : originY + col;
+    };
+    auto isOpaque = [&](int x, int y) {
+        if (!map.inBounds(x, y)) return true;
+        const uint8_t tile = map.get(x, y);
+        return tile < 32 && ((opaqueTiles >> tile) & 1);
+    };
+    const int radiusSquared = radius * radius + radius;  // A slightly rounder circle than r^2
+
+    rowStack.clear();
+    if (radius > 0) {
+        rowStack.push_back(Row{1, -1, 1, 1, 1});
+    }
+
+    while (!rowStack.empty()) {
+        Row row = rowStack.back();
+        rowStack.pop_back();
+
+        // Columns whose centres fall within the slopes, rounding ties outward
+        const int minCol = floorDiv(2 * row.depth * row.startNum + row.startDen, 2 * row.startDen);
+        const int maxCol = ceilDiv(2 * row.depth * row.endNum - row.endDen, 2 * row.endDen);
+
+        int previous = -1;  // -1 none yet, 0 floor, 1 wall
+        for (int col = minCol; col <= maxCol; col++) {
+            const int x = tileX(row.depth, col);
+            const int y = tileY(row.depth, col);
+            const bool wall = isOpaque(x, y);
+
+            // Walls are lit wherever the row touches them; floors only if their centre is
+            // inside the slopes (that is what keeps sight symmetric)
+            const bool centreInside = col * row.startDen >= row.depth * row.startNum &&
+                                      col * row.endDen <= row.depth * row.endNum;
+            if ((wall || centreInside) && map.inBounds(x, y) && row.depth * row.depth + col * col <= radiusSquared) {
+                reveal(x, y);
+            }
+
+            if (previous == 1 && !wall) {
+                // Leaving a wall: the rest of this row starts at the wall's trailing edge
+                row.startNum = 2 * col - 1;
+                row.startDen = 2 * row.depth;
+            }
+            if (previous == 0 && wall && row.depth < radius) {
+                // Entering a wall: the rows behind see up to its leading edge
+                rowStack.push_back(Row{row.depth + 1, row.startNum, row.startDen, 2 * col - 1, 2 * row.depth});
+            }
+            previous = wall ? 1 : 0;
+        }
+
+        if (previous == 0 && row.depth < radius) {
+            rowStack.push_back(Row{row.depth + 1, row.startNum, row.startDen, row.endNum, row.endDen});
+        }
+    }
+}
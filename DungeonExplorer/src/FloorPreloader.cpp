@@ -0,0 +1,83 @@
+#include "FloorPreloader.h"
+#include "Dungeon.h"
+#include "Enemy.h"
+#include "DungeonLevelManager.h"
+#include <iostream>
+
+PreparedFloor::PreparedFloor(int floor) : floor(floor) {
+}
+
+PreparedFloor::~PreparedFloor() = default;
+
+// One build is in flight at a time, so the queue never holds more than one floor
+FloorPreloader::FloorPreloader(const DungeonLevelManager& levels) : levels(levels), finished(2), pendingFloor(-1) {
+}
+
+FloorPreloader::~FloorPreloader() {
+    cancel();
+}
+
+void FloorPreloader::request(int floor) {
+    if (pendingFloor == floor) return;  // Already building it
+    cancel();
+    
+    pendingFloor = floor;
+    const DungeonLevelManager* table = &levels;
+    SpscQueue<std::unique_ptr<PreparedFloor>>* out = &finished;
+    worker = std::thread([table, out, floor]() {
+        // Nothing may escape the thread (std::terminate), so the allocations are inside the try too
+        std::unique_ptr<PreparedFloor> prepared;
+        try {
+            prepared = std::make_unique<PreparedFloor>(floor);
+            prepared->dungeon = std::make_unique<Dungeon>();
+            prepared->enemies = std::make_unique<EnemyManager>();
+            table->buildLevel(floor, *prepared->dungeon, *prepared->enemies);
+        } catch (...) {
+            // Hand back only the error; if even that can't be allocated, hand back nothing
+            // (take() then returns nullptr and the caller generates the floor itself)
+            try {
+                auto failed = std::make_unique<PreparedFloor>(floor);
+                failed->error = std::current_exception();
+                prepared = std::move(failed);
+            } catch (...) {
+                prepared.reset();
+            }
+        }
+        out->enqueue(std::move(prepared));
+    });
+    std::cout << "[FloorPreloader] Building floor " << floor << " in the background" << std::endl;
+}
+
+void FloorPreloader::collect() {
+    std::unique_ptr<PreparedFloor> prepared;
+    while (finished.try_dequeue(prepared)) {
+        ready = std::move(prepared);
+    }
+}
+
+bool FloorPreloader::isReady() {
+    collect();
+    return ready != nullptr;
+}
+
+std::unique_ptr<PreparedFloor> FloorPreloader::take(int floor) {
+    if (pendingFloor != floor) return nullptr;
+    
+    if (!isReady()) {
+        std::cout << "[FloorPreloader] Floor " << floor << " not ready yet - waiting for the build" << std::endl;
+    }
+    if (worker.joinable()) worker.join();  // The worker has enqueued its floor once it returns
+    collect();
+    pendingFloor = -1;
+    
+    std::unique_ptr<PreparedFloor> prepared = std::move(ready);
+    if (prepared && prepared->error) std::rethrow_exception(prepared->error);
+    return prepared;
+}
+
+void FloorPreloader::cancel() {
+    if (worker.joinable()) worker.join();
+    collect();
+    ready.reset();
+    pendingFloor = -1;
+}
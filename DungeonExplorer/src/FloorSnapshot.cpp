@@ -0,0 +1,496 @@
+// CHANGE: 2026-10-17 - Floor snapshot writer and mapped reader (see FloorSnapshot.h)
+
+#include "FloorSnapshot.h"
+#include "Dungeon.h"
+#include "Enemy.h"
+#include "Loot.h"
+#include <nlohmann/json.hpp>
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <cstring>
+#include <type_traits>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(sizeof(Snapshot::Header) == 184, "Snapshot::Header layout changed");
+static_assert(sizeof(Snapshot::Room) == 24 && sizeof(Snapshot::Edge) == 12 && sizeof(Snapshot::Door) == 20,
+              "Snapshot record layout changed");
+static_assert(sizeof(Snapshot::Spawn) == 64 && sizeof(Snapshot::LootItem) == 68, "Snapshot record layout changed");
+static_assert(sizeof(ChunkedTileMap::Chunk) == ChunkedTileMap::CHUNK_TILES + ChunkedTileMap::CHUNK_SIZE * 8 &&
+              std::is_trivially_copyable<ChunkedTileMap::Chunk>::value,
+              "Chunks are stored as they sit in memory");
+
+namespace {
+    // Record size of each section, in Section order
+    const size_t RECORD_BYTES[Snapshot::SectionCount] = {
+        sizeof(uint32_t),
+        sizeof(ChunkedTileMap::Chunk),
+        sizeof(Snapshot::Room),
+        sizeof(Snapshot::Edge),
+        sizeof(Snapshot::Door),
+        sizeof(Snapshot::Spawn),
+        sizeof(Snapshot::LootItem),
+        1,
+    };
+
+    bool hostIsLittleEndian() {
+        const uint16_t probe = 1;
+        unsigned char first;
+        std::memcpy(&first, &probe, 1);
+        return first == 1;
+    }
+
+    uint32_t load32(const unsigned char* p) {
+        return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+    }
+
+    // Slicing-by-8 tables for the reflected CRC-32 polynomial (zlib's)
+    struct CrcTables {
+        uint32_t table[8][256];
+
+        CrcTables() {
+            for (uint32_t i = 0; i < 256; i++) {
+                uint32_t crc = i;
+                for (int bit = 0; bit < 8; bit++) {
+                    crc = (crc & 1) ? 0xEDB88320u ^ (crc >> 1) : crc >> 1;
+                }
+                table[0][i] = crc;
+            }
+            for (uint32_t i = 0; i < 256; i++) {
+                for (int slice = 1; slice < 8; slice++) {
+                    table[slice][i] = (table[slice - 1][i] >> 8) ^ table[0][table[slice - 1][i] & 0xFF];
+                }
+            }
+        }
+    };
+
+    // File image under construction: header space, then sections appended in order
+    class ImageWriter {
+    public:
+        std::vector<unsigned char> bytes;
+        Snapshot::Header header{};
+
+        ImageWriter() : bytes(sizeof(Snapshot::Header), 0) {}
+
+        void addSection(Snapshot::Section section, const void* data, size_t count) {
+            bytes.resize((bytes.size() + 7) & ~size_t(7), 0);
+            const size_t size = count * RECORD_BYTES[section];
+            Snapshot::SectionEntry& entry = header.sections[section];
+            entry.offset = static_cast<uint32_t>(bytes.size());
+            entry.count = static_cast<uint32_t>(count);
+            entry.bytes = static_cast<uint32_t>(size);
+            entry.crc = FloorSnapshot::crc32(data, size);
+            if (size > 0) {
+                const unsigned char* source = static_cast<const unsigned char*>(data);
+                bytes.insert(bytes.end(), source, source + size);
+            }
+        }
+
+        template<typename T>
+        void addSection(Snapshot::Section section, const std::vector<T>& records) {
+            addSection(section, records.data(), records.size());
+        }
+
+        void finish() {
+            header.headerCrc = FloorSnapshot::crc32(&header, offsetof(Snapshot::Header, headerCrc));
+            std::memcpy(bytes.data(), &header, sizeof(header));
+        }
+    };
+
+    Snapshot::Text addText(std::string& strings, const std::string& text) {
+        Snapshot::Text ref{static_cast<uint32_t>(strings.size()), static_cast<uint32_t>(text.size())};
+        strings += text;
+        return ref;
+    }
+
+    nlohmann::json parseJson(std::string_view text) {
+        nlohmann::json value = nlohmann::json::parse(text.begin(), text.end(), nullptr, false);
+        return value.is_discarded() ? nlohmann::json() : value;
+    }
+}
+
+uint32_t FloorSnapshot::crc32(const void* data, size_t bytes) {
+    static const CrcTables tables;
+    const uint32_t (&t)[8][256] = tables.table;
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+
+    uint32_t crc = 0xFFFFFFFFu;
+    for (; bytes >= 8; bytes -= 8, p += 8) {
+        const uint32_t one = crc ^ load32(p);
+        const uint32_t two = load32(p + 4);
+        crc = t[7][one & 0xFF] ^ t[6][(one >> 8) & 0xFF] ^ t[5][(one >> 16) & 0xFF] ^ t[4][one >> 24] ^
+              t[3][two & 0xFF] ^ t[2][(two >> 8) & 0xFF] ^ t[1][(two >> 16) & 0xFF] ^ t[0][two >> 24];
+    }
+    for (; bytes > 0; bytes--, p++) {
+        crc = (crc >> 8) ^ t[0][(crc ^ *p) & 0xFF];
+    }
+    return ~crc;
+}
+
+bool FloorSnapshot::write(const std::string& path, int floor, uint64_t runSeed, const Dungeon& dungeon,
+                          const EnemyManager& enemies, const std::vector<Loot>& loots) {
+    if (!hostIsLittleEndian()) {
+        std::cerr << "[FloorSnapshot] Snapshots are little-endian; not writing " << path << std::endl;
+        return false;
+    }
+
+    const ChunkedTileMap& map = dungeon.getTileMap();
+    ImageWriter image;
+    Snapshot::Header& header = image.header;
+    header.magic = Snapshot::MAGIC;
+    header.version = Snapshot::VERSION;
+    header.headerBytes = sizeof(Snapshot::Header);
+    header.runSeed = runSeed;
+    header.floor = floor;
+    header.width = map.width();
+    header.height = map.height();
+    header.fillTile = map.fill();
+    header.flags = dungeon.haveClearableDoorsOpened() ? Snapshot::FLAG_CLEAR_DOORS_OPENED : 0;
+    header.startRoomId = dungeon.getStartRoomId();
+    header.stairsRoomId = dungeon.getStairsRoomId();
+    header.stairsX = dungeon.getStairsX();
+    header.stairsY = dungeon.getStairsY();
+
+    // Tiles: the chunk directory, then every allocated chunk verbatim
+    std::vector<uint32_t> directory(static_cast<size_t>(map.chunkCountX()) * map.chunkCountY(), Snapshot::NO_CHUNK);
+    std::vector<const ChunkedTileMap::Chunk*> allocated;
+    allocated.reserve(map.allocatedChunks());
+    map.forEachChunk([&](int chunkX, int chunkY, const ChunkedTileMap::Chunk& chunk) {
+        directory[static_cast<size_t>(chunkY) * map.chunkCountX() + chunkX] = static_cast<uint32_t>(allocated.size());
+        allocated.push_back(&chunk);
+    });
+    image.addSection(Snapshot::Chunks, directory);
+
+    image.bytes.resize((image.bytes.size() + 7) & ~size_t(7), 0);
+    const size_t chunkDataOffset = image.bytes.size();
+    for (const ChunkedTileMap::Chunk* chunk : allocated) {
+        const unsigned char* source = reinterpret_cast<const unsigned char*>(chunk);
+        image.bytes.insert(image.bytes.end(), source, source + sizeof(ChunkedTileMap::Chunk));
+    }
+    Snapshot::SectionEntry& chunkData = header.sections[Snapshot::ChunkData];
+    chunkData.offset = static_cast<uint32_t>(chunkDataOffset);
+    chunkData.count = static_cast<uint32_t>(allocated.size());
+    chunkData.bytes = static_cast<uint32_t>(allocated.size() * sizeof(ChunkedTileMap::Chunk));
+    chunkData.crc = crc32(image.bytes.data() + chunkDataOffset, chunkData.bytes);
+
+    // Rooms and the room graph (each undirected edge once, from its lower id)
+    std::vector<Snapshot::Room> rooms;
+    std::vector<Snapshot::Edge> edges;
+    rooms.reserve(dungeon.getRooms().size());
+    for (const Room& room : dungeon.getRooms()) {
+        Snapshot::Room record{};
+        record.id = room.id;
+        record.x = room.x;
+        record.y = room.y;
+        record.width = room.width;
+        record.height = room.height;
+        record.type = static_cast<uint8_t>(room.type);
+        record.cleared = room.cleared ? 1 : 0;
+        rooms.push_back(record);
+
+        dungeon.getGraph().forEachNeighbor(room.id, [&](int neighbor, int weight) {
+            if (room.id < neighbor) {
+                edges.push_back(Snapshot::Edge{room.id, neighbor, weight});
+            }
+        });
+    }
+    image.addSection(Snapshot::Rooms, rooms);
+    image.addSection(Snapshot::Edges, edges);
+
+    std::vector<Snapshot::Door> doors;
+    doors.reserve(dungeon.getDoors().size());
+    for (const DoorData& door : dungeon.getDoors()) {
+        Snapshot::Door record{};
+        record.x = door.x;
+        record.y = door.y;
+        record.roomA = door.roomA;
+        record.roomB = door.roomB;
+        record.isOpen = door.isOpen ? 1 : 0;
+        record.requiresKey = door.requiresKey ? 1 : 0;
+        record.openOnClear = door.openOnClear ? 1 : 0;
+        doors.push_back(record);
+    }
+    image.addSection(Snapshot::Doors, doors);
+
+    std::string strings;
+    std::vector<Snapshot::Spawn> spawns;
+    spawns.reserve(enemies.getEnemies().size());
+    for (const EnemyData& enemy : enemies.getEnemies()) {
+        Snapshot::Spawn record{};
+        record.id = enemy.id;
+        record.health = enemy.health;
+        record.maxHealth = enemy.maxHealth;
+        record.damage = enemy.damage;
+        record.x = enemy.x;
+        record.y = enemy.y;
+        record.attackRange = enemy.attackRange;
+        record.moveSpeed = enemy.moveSpeed;
+        record.aiLevel = enemy.aiLevel;
+        record.floorLevel = enemy.floorLevel;
+        record.name = addText(strings, enemy.name);
+        record.type = addText(strings, enemy.type);
+        record.dropTable = addText(strings, enemy.dropTableJson.dump());
+        spawns.push_back(record);
+    }
+    image.addSection(Snapshot::Spawns, spawns);
+
+    std::vector<Snapshot::LootItem> lootItems;
+    lootItems.reserve(loots.size());
+    for (const Loot& loot : loots) {
+        const ItemNew& item = loot.getItem();
+        Snapshot::LootItem record{};
+        record.x = loot.getX();
+        record.y = loot.getY();
+        record.rarity = item.rarity;
+        record.value = item.value;
+        record.cooldown = item.cooldown;
+        record.id = addText(strings, item.id);
+        record.name = addText(strings, item.name);
+        record.type = addText(strings, item.type);
+        record.iconPath = addText(strings, item.iconPath);
+        record.actionKind = addText(strings, item.action.kind);
+        record.actionParams = addText(strings, item.action.params.dump());
+        lootItems.push_back(record);
+    }
+    image.addSection(Snapshot::Loot, lootItems);
+    image.addSection(Snapshot::Strings, strings.data(), strings.size());
+    image.finish();
+
+    // Write beside the target and rename, so a crash never leaves a half-written snapshot
+    std::error_code error;
+    const std::filesystem::path target(path);
+    if (target.has_parent_path()) {
+        std::filesystem::create_directories(target.parent_path(), error);
+    }
+    const std::string temporary = path + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(image.bytes.data()), static_cast<std::streamsize>(image.bytes.size()));
+        if (!file) {
+            std::cerr << "[FloorSnapshot] Could not write " << temporary << std::endl;
+            return false;
+        }
+    }
+    std::filesystem::rename(temporary, target, error);
+    if (error) {
+        std::cerr << "[FloorSnapshot] Could not replace " << path << ": " << error.message() << std::endl;
+        std::filesystem::remove(temporary, error);
+        return false;
+    }
+    return true;
+}
+
+FloorSnapshot::~FloorSnapshot() {
+    close();
+}
+
+void FloorSnapshot::close() {
+#if !defined(_WIN32)
+    if (mapped) {
+        munmap(const_cast<unsigned char*>(base), fileBytes);
+    }
+#endif
+    header = nullptr;
+    base = nullptr;
+    fileBytes = 0;
+    chunksX = 0;
+    chunksY = 0;
+    mapped = false;
+    buffer.clear();
+    buffer.shrink_to_fit();
+}
+
+bool FloorSnapshot::open(const std::string& path) {
+    close();
+
+#if defined(_WIN32)
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        std::cerr << "[FloorSnapshot] Could not open " << path << std::endl;
+        return false;
+    }
+    fileBytes = static_cast<size_t>(file.tellg());
+    buffer.resize((fileBytes + 7) / 8);
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(fileBytes));
+    if (!file) {
+        std::cerr << "[FloorSnapshot] Could not read " << path << std::endl;
+        close();
+        return false;
+    }
+    base = reinterpret_cast<const unsigned char*>(buffer.data());
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "[FloorSnapshot] Could not open " << path << std::endl;
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(Snapshot::Header))) {
+        std::cerr << "[FloorSnapshot] " << path << " is too short to be a snapshot" << std::endl;
+        ::close(fd);
+        return false;
+    }
+    fileBytes = static_cast<size_t>(info.st_size);
+    void* view = mmap(nullptr, fileBytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // The mapping keeps the file alive
+    if (view == MAP_FAILED) {
+        std::cerr << "[FloorSnapshot] Could not map " << path << std::endl;
+        fileBytes = 0;
+        return false;
+    }
+    base = static_cast<const unsigned char*>(view);
+    mapped = true;
+#endif
+
+    if (!validate(path)) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool FloorSnapshot::validate(const std::string& path) {
+    auto reject = [&](const char* reason) {
+        std::cerr << "[FloorSnapshot] Rejected " << path << ": " << reason << std::endl;
+        return false;
+    };
+
+    if (!hostIsLittleEndian()) return reject("snapshots are little-endian");
+    if (fileBytes < sizeof(Snapshot::Header)) return reject("truncated header");
+
+    const Snapshot::Header* candidate = reinterpret_cast<const Snapshot::Header*>(base);
+    if (candidate->magic != Snapshot::MAGIC) return reject("not a floor snapshot");
+    if (candidate->version != Snapshot::VERSION || candidate->headerBytes != sizeof(Snapshot::Header)) {
+        return reject("unsupported version");
+    }
+    if (candidate->headerCrc != crc32(candidate, offsetof(Snapshot::Header, headerCrc))) {
+        return reject("header checksum mismatch");
+    }
+
+    const int MAX_SIDE = 1 << 16;
+    if (candidate->width <= 0 || candidate->height <= 0 || candidate->width > MAX_SIDE || candidate->height > MAX_SIDE) {
+        return reject("bad map size");
+    }
+
+    for (uint32_t section = 0; section < Snapshot::SectionCount; section++) {
+        const Snapshot::SectionEntry& entry = candidate->sections[section];
+        if (entry.offset % 8 != 0 || entry.offset < sizeof(Snapshot::Header) ||
+            uint64_t(entry.offset) + entry.bytes > fileBytes ||
+            uint64_t(entry.count) * RECORD_BYTES[section] != entry.bytes) {
+            return reject("section out of range");
+        }
+        if (crc32(base + entry.offset, entry.bytes) != entry.crc) {
+            return reject("section checksum mismatch");
+        }
+    }
+
+    header = candidate;
+    chunksX = (header->width + ChunkedTileMap::CHUNK_MASK) >> ChunkedTileMap::CHUNK_SHIFT;
+    chunksY = (header->height + ChunkedTileMap::CHUNK_MASK) >> ChunkedTileMap::CHUNK_SHIFT;
+
+    const View<uint32_t> directory = view<uint32_t>(Snapshot::Chunks);
+    if (directory.size() != static_cast<size_t>(chunksX) * chunksY) {
+        return reject("chunk directory does not match the map size");
+    }
+    const uint32_t chunkCount = header->sections[Snapshot::ChunkData].count;
+    for (uint32_t entry : directory) {
+        if (entry != Snapshot::NO_CHUNK && entry >= chunkCount) return reject("chunk index out of range");
+    }
+
+    // Room ids double as indices (room graph, route lookups, the DSA overlay)
+    const View<Snapshot::Room> savedRooms = rooms();
+    const int32_t roomCount = static_cast<int32_t>(savedRooms.size());
+    for (int32_t i = 0; i < roomCount; i++) {
+        if (savedRooms[i].id != i) return reject("room ids are not their indices");
+    }
+    auto isRoom = [&](int32_t id) { return id >= 0 && id < roomCount; };
+    for (const Snapshot::Edge& edge : edges()) {
+        if (!isRoom(edge.roomA) || !isRoom(edge.roomB) || edge.weight < 0) return reject("bad room graph edge");
+    }
+    if (roomCount > 0 && (!isRoom(header->startRoomId) || (header->stairsRoomId != -1 && !isRoom(header->stairsRoomId)))) {
+        return reject("entrance or stairs room out of range");
+    }
+
+    // Everything that is later used as a tile index must lie on the map
+    const int32_t mapWidth = header->width;
+    const int32_t mapHeight = header->height;
+    auto onMap = [&](int32_t x, int32_t y) { return x >= 0 && y >= 0 && x < mapWidth && y < mapHeight; };
+    for (const Snapshot::Room& room : savedRooms) {
+        if (room.width <= 0 || room.height <= 0 || !onMap(room.x, room.y) ||
+            int64_t(room.x) + room.width > mapWidth || int64_t(room.y) + room.height > mapHeight) {
+            return reject("room outside the map");
+        }
+    }
+    for (const Snapshot::Door& door : doors()) {
+        if (!onMap(door.x, door.y) || !isRoom(door.roomA) || !isRoom(door.roomB)) return reject("bad door");
+    }
+    const bool noStairs = header->stairsRoomId == -1 && header->stairsX == -1 && header->stairsY == -1;
+    if (!noStairs && !onMap(header->stairsX, header->stairsY)) {
+        return reject("stairs outside the map");
+    }
+
+    for (const Snapshot::Spawn& spawn : spawns()) {
+        if (!onMap(spawn.x, spawn.y)) return reject("enemy outside the map");
+        if (!textInRange(spawn.name) || !textInRange(spawn.type) || !textInRange(spawn.dropTable)) {
+            return reject("enemy text out of range");
+        }
+    }
+    for (const Snapshot::LootItem& item : loot()) {
+        if (!onMap(item.x, item.y)) return reject("loot outside the map");
+        if (!textInRange(item.id) || !textInRange(item.name) || !textInRange(item.type) ||
+            !textInRange(item.iconPath) || !textInRange(item.actionKind) || !textInRange(item.actionParams)) {
+            return reject("loot text out of range");
+        }
+    }
+    return true;
+}
+
+bool FloorSnapshot::textInRange(Snapshot::Text ref) const {
+    return uint64_t(ref.offset) + ref.length <= header->sections[Snapshot::Strings].bytes;
+}
+
+std::string_view FloorSnapshot::text(Snapshot::Text ref) const {
+    const char* strings = reinterpret_cast<const char*>(base + header->sections[Snapshot::Strings].offset);
+    return std::string_view(strings + ref.offset, ref.length);
+}
+
+const ChunkedTileMap::Chunk* FloorSnapshot::chunkAt(int chunkX, int chunkY) const {
+    const uint32_t entry = view<uint32_t>(Snapshot::Chunks)[static_cast<size_t>(chunkY) * chunksX + chunkX];
+    if (entry == Snapshot::NO_CHUNK) return nullptr;
+    return view<ChunkedTileMap::Chunk>(Snapshot::ChunkData).data + entry;
+}
+
+bool FloorSnapshot::restore(Dungeon& dungeon, EnemyManager& enemies, std::vector<Loot>& loots) const {
+    if (!isOpen() || !dungeon.restore(*this)) return false;
+
+    std::vector<EnemyData> saved;
+    saved.reserve(spawns().size());
+    for (const Snapshot::Spawn& spawn : spawns()) {
+        EnemyData enemy(spawn.id, std::string(text(spawn.name)), std::string(text(spawn.type)), spawn.maxHealth,
+                        spawn.damage, spawn.x, spawn.y, spawn.attackRange, spawn.moveSpeed);
+        enemy.health = spawn.health;
+        enemy.aiLevel = spawn.aiLevel;
+        enemy.floorLevel = spawn.floorLevel;
+        enemy.dropTableJson = parseJson(text(spawn.dropTable));
+        saved.push_back(std::move(enemy));
+    }
+    enemies.restore(std::move(saved));
+
+    loots.clear();
+    loots.reserve(loot().size());
+    for (const Snapshot::LootItem& item : loot()) {
+        ItemNew restored(std::string(text(item.id)), std::string(text(item.name)), std::string(text(item.type)),
+                         item.rarity, item.value,
+                         ItemAction(std::string(text(item.actionKind)), parseJson(text(item.actionParams))),
+                         std::string(text(item.iconPath)), item.cooldown);
+        loots.emplace_back(restored, item.x, item.y);
+    }
+    return true;
+}
@@ -0,0 +1,106 @@
+#include "FlowField.h"
+#include "GridSteps.h"
+#include <algorithm>
+
+FlowField::FlowField() : width(0), height(0), chunksX(0), version(0), built(false) {
+}
+
+uint32_t FlowField::cellIndex(int x, int y) const {
+    if (static_cast<unsigned>(x) >= static_cast<unsigned>(width) ||
+        static_cast<unsigned>(y) >= static_cast<unsigned>(height)) {
+        return NO_SLOT;
+    }
+    
+    uint32_t slot = chunkSlot[(y >> ChunkedTileMap::CHUNK_SHIFT) * chunksX + (x >> ChunkedTileMap::CHUNK_SHIFT)];
+    if (slot == NO_SLOT) return NO_SLOT;
+    return slot * ChunkedTileMap::CHUNK_TILES +
+           (((y & ChunkedTileMap::CHUNK_MASK) << ChunkedTileMap::CHUNK_SHIFT) | (x & ChunkedTileMap::CHUNK_MASK));
+}
+
+void FlowField::compute(const ChunkedTileMap& map, const std::vector<std::pair<int, int>>& goals,
+                        unsigned int layoutVersion) {
+    width = map.width();
+    height = map.height();
+    chunksX = map.chunkCountX();
+    
+    // Give every carved chunk a slot; solid chunks can never be reached
+    chunkSlot.assign(static_cast<size_t>(chunksX) * map.chunkCountY(), NO_SLOT);
+    uint32_t slots = 0;
+    for (int cy = 0; cy < map.chunkCountY(); cy++) {
+        for (int cx = 0; cx < chunksX; cx++) {
+            if (map.chunkAt(cx, cy)) {
+                chunkSlot[cy * chunksX + cx] = slots++;
+            }
+        }
+    }
+    distance.assign(static_cast<size_t>(slots) * ChunkedTileMap::CHUNK_TILES, UNREACHABLE);
+    
+    // Multi-source BFS: every edge costs 1, so BFS order is Dijkstra order
+    frontier.clear();
+    for (const auto& goal : goals) {
+        uint32_t index = cellIndex(goal.first, goal.second);
+        if (index == NO_SLOT || distance[index] == 0) continue;
+        distance[index] = 0;
+        frontier.push_back(static_cast<uint32_t>(goal.second) * width + goal.first);
+    }
+    
+    for (size_t head = 0; head < frontier.size(); head++) {
+        const int x = static_cast<int>(frontier[head] % width);
+        const int y = static_cast<int>(frontier[head] / width);
+        const uint32_t nextDistance = distance[cellIndex(x, y)] + 1;
+        
+        for (int dir = 0; dir < 4; dir++) {
+            const int nx = x + STEP_X[dir];
+            const int ny = y + STEP_Y[dir];
+            if (!map.inBounds(nx, ny) || !map.walkable(nx, ny)) continue;
+            
+            uint32_t& d = distance[cellIndex(nx, ny)];
+            if (d != UNREACHABLE) continue;
+            d = nextDistance;
+            frontier.push_back(static_cast<uint32_t>(ny) * width + nx);
+        }
+    }
+    
+    goalTiles = goals;
+    version = layoutVersion;
+    built = true;
+}
+
+uint32_t FlowField::distanceAt(int x, int y) const {
+    uint32_t index = cellIndex(x, y);
+    return index == NO_SLOT ? UNREACHABLE : distance[index];
+}
+
+std::pair<int, int> FlowField::stepToward(int x, int y) const {
+    std::pair<int, int> best = {x, y};
+    uint32_t bestDistance = distanceAt(x, y);
+    
+    for (int dir = 0; dir < 4; dir++) {
+        const int nx = x + STEP_X[dir];
+        const int ny = y + STEP_Y[dir];
+        const uint32_t d = distanceAt(nx, ny);
+        if (d < bestDistance) {
+            bestDistance = d;
+            best = {nx, ny};
+        }
+    }
+    return best;
+}
+
+std::pair<int, int> FlowField::stepAway(int x, int y) const {
+    std::pair<int, int> best = {x, y};
+    const uint32_t here = distanceAt(x, y);
+    if (here == UNREACHABLE) return best;  // Not connected to any goal: nothing to flee from
+    
+    uint32_t bestDistance = here;
+    for (int dir = 0; dir < 4; dir++) {
+        const int nx = x + STEP_X[dir];
+        const int ny = y + STEP_Y[dir];
+        const uint32_t d = distanceAt(nx, ny);
+        if (d != UNREACHABLE && d > bestDistance) {
+            bestDistance = d;
+            best = {nx, ny};
+        }
+    }
+    return best;
+}
@@ -27,14 +27,17 @@
 #include "Renderer.h"
 #include "AssetManager.h"
 #include "DungeonLevelManager.h"
+#include "FloorPreloader.h"
 #include "ItemManager.h"
 #include "ItemNew.h"
 #include "Loot.h"
 #include "DropTable.h"
+#include "Random.h"
 #include "Shop.h"
 #include "DataStructures/Heap.h"
 #include "DataStructures/HashTable.h"
 #include <iostream>
+#include <cmath>
 
 Game::Game() 
     : window(sf::VideoMode({800, 600}), "Dungeon Explorer - DSA Game"),
@@ -88,6 +91,10 @@ void Game::initialize() {
         player->initialize(startRoom.x + 1, startRoom.y + 1);
     }
     
+    // CHANGE: 2026-10-16 - Floor 2 is generated in the background while floor 1 is played
+    floorPreloader = std::make_unique<FloorPreloader>(*levelManager);
+    floorPreloader->request(currentFloor + 1);
+    
     std::cout << "\n[Game] " << levelManager->getFloorDisplayText(currentFloor) << std::endl;
     std::cout << "[Game] " << levelManager->getFloorDescription(currentFloor) << "\n" << std::endl;
     
@@ -103,6 +110,7 @@ void Game::initialize() {
     std::cout << "  - Rooms: " << dungeon->getRooms().size() << " connected as graph" << std::endl;
     std::cout << "  - Uses: BFS, DFS, Dijkstra pathfinding for room traversal" << std::endl;
     dungeon->visualizeDijkstra(0);
+    dungeon->getGraph().traceStats().print(std::cout, "Room graph operations");
     
     // LinkedList: Player Inventory
     std::cout << "\n✓ LINKED LIST (Player Inventory):" << std::endl;
@@ -113,6 +121,8 @@ void Game::initialize() {
     std::cout << "\n✓ STACK (Movement History/Backtracking):" << std::endl;
     std::cout << "  - Movement Stack: Tracks player path for backtracking (Press B)" << std::endl;
     std::cout << "  - Operations: push (move), pop (backtrack)" << std::endl;
+    std::cout << "  - Storage: run-length encoded moves, bounded to ~"
+              << (MovementHistory::DEFAULT_HOT_WORDS * 2 + MovementHistory::DEFAULT_COLD_BYTES) / 1024 << " KB" << std::endl;
     
     // Hash Table: Item Database
     std::cout << "\n✓ HASH TABLE (Item Database):" << std::endl;
@@ -285,46 +295,40 @@ void Game::handleInput(const sf::Event& event) {
                 // Quick unlock next skill (O for unl-O-ck) when points available
                 if (skillTree && skillTree->getAvailablePoints() > 0) {
                     // Try to unlock next available skill in tree order with proper hotkeys
-                    auto tryUnlock = [&](std::shared_ptr<BinaryTree<Skill>::Node> node, int hotkey) -> bool {
-                        if (!node) return false;
-                        if (!node->data.unlocked && skillTree->canUnlock(node)) {
-                            // Assign hotkey if it's an active skill and doesn't have one
-                            if (node->data.type == "active" && node->data.hotkey == 0) {
-                                node->data.hotkey = hotkey;
-                                std::cout << "[SkillTree] Assigned hotkey " << hotkey << " to " << node->data.name << std::endl;
-                            }
-                            skillTree->unlockSkill(node);
-                            Position playerPos = player->getPosition();
-                            std::string hotkeyInfo = (node->data.type == "active" && node->data.hotkey > 0) 
-                                ? " [Press " + std::to_string(node->data.hotkey) + "]" : "";
-                            uiManager->addFloatingText("Unlocked: " + node->data.name + hotkeyInfo, 
-                                playerPos.x * 32.0f, playerPos.y * 32.0f, sf::Color(100, 255, 100));
-                            return true;
+                    auto tryUnlock = [&](std::string_view id, int hotkey) -> bool {
+                        SkillHandle node = skillTree->findSkill(id);
+                        if (!skillTree->canUnlock(node)) return false;  // Also false for unknown ids
+                        
+                        Skill& skill = skillTree->getSkill(node);
+                        // Assign hotkey if it's an active skill and doesn't have one
+                        if (skill.type == "active" && skill.hotkey == 0) {
+                            skill.hotkey = hotkey;
+                            std::cout << "[SkillTree] Assigned hotkey " << hotkey << " to " << skill.name << std::endl;
                         }
-                        return false;
+                        skillTree->unlockSkill(node);
+                        Position playerPos = player->getPosition();
+                        std::string hotkeyInfo = (skill.type == "active" && skill.hotkey > 0) 
+                            ? " [Press " + std::to_string(skill.hotkey) + "]" : "";
+                        uiManager->addFloatingText("Unlocked: " + skill.name + hotkeyInfo, 
+                            playerPos.x * 32.0f, playerPos.y * 32.0f, sf::Color(100, 255, 100));
+                        return true;
                     };
                     
                     // Try to unlock skills in order: Power Strike (2), Whirlwind (3), Flame Wave (4), Shadow Step (5)
-                    auto root = skillTree->getRoot();
-                    // CHANGE: 2025-11-14 - Add bounds checking to prevent crashes on malformed trees
-                    if (root && root->left && tryUnlock(root->left, 2)) {
+                    // CHANGE: 2026-10-16 - Look skills up by id instead of walking root->left->left
+                    if (tryUnlock("power_strike", 2)) {
                         std::cout << "[SkillTree] Power Strike unlocked! Press O again for more skills!" << std::endl;
                     } 
-                    // Try to unlock whirlwind (depth 2)
-                    else if (root && root->left && root->left->left && tryUnlock(root->left->left, 3)) {
+                    else if (tryUnlock("whirlwind", 3)) {
                         std::cout << "[SkillTree] Whirlwind unlocked! Press O again for more skills!" << std::endl;
                     }
-                    // Try to unlock flame wave (depth 3) - with bounds check
-                    else if (root && root->left && root->left->left && 
-                             root->left->left->left && tryUnlock(root->left->left->left, 4)) {
+                    else if (tryUnlock("flame_wave", 4)) {
                         std::cout << "[SkillTree] Flame Wave unlocked! Press O again for more skills!" << std::endl;
                     }
-                    // Try right branch - shadow step (depth 2) - with bounds check
-                    else if (root && root->right && root->right->right && tryUnlock(root->right->right, 5)) {
+                    else if (tryUnlock("shadow_step", 5)) {
                         std::cout << "[SkillTree] Shadow Step unlocked! Press O again for more skills!" << std::endl;
                     }
-                    // Try other right branch skills (depth 1)
-                    else if (root && root->right && tryUnlock(root->right, 0)) {  // Passive skills
+                    else if (tryUnlock("mana_surge", 0)) {  // Passive skills
                         std::cout << "[SkillTree] Mana Surge unlocked (passive)! Press O again!" << std::endl;
                     }
                     else {
@@ -347,19 +351,9 @@ void Game::handleInput(const sf::Event& event) {
             case sf::Keyboard::Key::U:
                 // Use first item in inventory (U for Use)
                 if (player && player->getInventoryNew().size() > 0) {
-                    // Get first item
-                    bool foundItem = false;
-                    std::string firstItemId;
-                    player->getInventoryNew().traverse([&](const ItemNew& item) {
-                        if (!foundItem) {
-                            firstItemId = item.id;
-                            foundItem = true;
-                        }
-                    });
-                    
-                    if (foundItem) {
-                        player->useItem(firstItemId);
-                    }
+                    // Get first item (copy the id: useItem may remove the node)
+                    std::string firstItemId = player->getInventoryNew().front().id;
+                    player->useItem(firstItemId);
                 }
                 return;
             case sf::Keyboard::Key::Num1:
@@ -439,20 +433,21 @@ void Game::handleInput(const sf::Event& event) {
                     if (pickedUpLoot) return;
                     
                     // Priority 2: Open door if adjacent
-                    for (auto& door : doors) {
-                        int dx = std::abs(door.x - currentPos.x);
-                        int dy = std::abs(door.y - currentPos.y);
-                        if (dx <= 1 && dy <= 1 && !door.isOpen) {
-                            if (door.requiresKey && !player->hasItem("dungeon_key")) {
+                    // CHANGE: 2026-10-16 - Probe the 3x3 tiles around the player in Dungeon's door layer
+                    for (int dy = -1; dy <= 1; dy++) {
+                        for (int dx = -1; dx <= 1; dx++) {
+                            const DoorData* door = dungeon->getDoorAt(currentPos.x + dx, currentPos.y + dy);
+                            if (!door || door->isOpen) continue;
+                            
+                            if (door->requiresKey && !player->hasItem("dungeon_key")) {
                                 uiManager->addFloatingText("Locked - Need Key", 
                                     currentPos.x * 32.0f, currentPos.y * 32.0f - 10.0f, 
                                     sf::Color(255, 100, 100));
                                 return;
                             }
                             
-                            door.isOpen = true;
-                            dungeon->setTile(door.x, door.y, TileType::Floor);
-                            std::cout << "[DEBUG] Door opened at (" << door.x << ", " << door.y << ") by player" << std::endl;
+                            dungeon->openDoor(door->x, door->y);
+                            std::cout << "[DEBUG] Door opened at (" << door->x << ", " << door->y << ") by player" << std::endl;
                             
                             uiManager->addFloatingText("Door Opened", 
                                 currentPos.x * 32.0f, currentPos.y * 32.0f - 10.0f, 
@@ -593,6 +588,12 @@ void Game::updateMainMenu(float deltaTime) {
 void Game::updatePlaying(float deltaTime) {
     if (player) {
         player->update(deltaTime);
+        
+        // CHANGE: 2026-10-16 - Sight follows the player (recomputed only after a move or a door change)
+        if (dungeon) {
+            const Position playerPos = player->getPosition();
+            dungeon->updateFieldOfView(playerPos.x, playerPos.y, SIGHT_RADIUS);
+        }
     }
 }
 
@@ -664,7 +665,7 @@ void Game::attackNearestEnemy() {
         // CHANGE: 2025-11-10 - New loot drop system using DropTable
         if (!nearestEnemy->dropTableJson.empty()) {
             DropTable dropTable = DropTable::fromJson(nearestEnemy->dropTableJson);
-            std::string dropId = dropTable.roll();
+            std::string dropId = dropTable.roll(Random::getInstance().shared(RandomDomain::Loot));
             
             std::cout << "DEBUG: Rolled drop -> " << dropId << " (from " << dropTable.size() << " entries)" << std::endl;
             
@@ -836,21 +837,30 @@ void Game::moveEnemiesWithBFS() {
     
     // CHANGE: 2025-11-14 - Check for room clear and open auto-clearing doors
     if (enemyManager->isEmpty()) {
-        // All enemies defeated - open all clearable doors
-        for (auto& door : doors) {
-            if (door.openOnClear && !door.isOpen) {
-                door.isOpen = true;
-                if (dungeon) {
-                    dungeon->setTile(door.x, door.y, TileType::Floor);
-                }
-                std::cout << "[Door] Room cleared. Auto-opened door at (" << door.x << ", " << door.y << ")" << std::endl;
-            }
+        // All enemies defeated - open all clearable doors (no-op after the first time)
+        int opened = dungeon->openClearableDoors();
+        if (opened > 0) {
+            std::cout << "[Door] Room cleared. Auto-opened " << opened << " doors" << std::endl;
         }
     }
     
     Position playerPos = player->getPosition();
     auto& enemies = const_cast<std::vector<EnemyData>&>(enemyManager->getEnemies());
     
+    // CHANGE: 2026-10-16 - One flow field per turn instead of one BFS per enemy, and an
+    // occupancy table instead of scanning every other enemy, so the phase is linear in enemies
+    // CHANGE: 2026-10-16 - ...built only once an enemy that shares the player's walkable region
+    // needs it. Enemies cut off from the player (closed doors, a separate cave) skip pathing.
+    const FlowField* towardPlayer = nullptr;
+    const int playerRegion = dungeon->getRegionAt(playerPos.x, playerPos.y);
+    const int mapWidth = dungeon->getWidth();
+    auto tileKey = [mapWidth](int x, int y) { return y * mapWidth + x; };
+    HashTable<int, int, NoTrace> occupied;  // Tile -> enemies standing on it
+    occupied.reserve(enemies.size());
+    for (const auto& enemy : enemies) {
+        occupied[tileKey(enemy.x, enemy.y)]++;
+    }
+    
     for (auto& enemy : enemies) {
         // Calculate distance to player
         int dx = abs(enemy.x - playerPos.x);
@@ -889,8 +899,15 @@ void Game::moveEnemiesWithBFS() {
             continue;  // Don't move, just attack
         }
         
-        // Calculate next move using BFS pathfinding
-        auto nextPos = dungeon->findNextMoveToPlayer(enemy.x, enemy.y, playerPos.x, playerPos.y);
+        if (playerRegion < 0 || dungeon->getRegionAt(enemy.x, enemy.y) != playerRegion) {
+            continue;  // No route to the player
+        }
+        
+        // Next step down the shared distance map
+        if (!towardPlayer) {
+            towardPlayer = &dungeon->getFlowField(FlowGoal::Player, playerPos.x, playerPos.y);
+        }
+        auto nextPos = towardPlayer->stepToward(enemy.x, enemy.y);
         
         // Check if enemy would move into player position (shouldn't happen with attack check above)
         if (nextPos.first == playerPos.x && nextPos.second == playerPos.y) {
@@ -900,16 +917,15 @@ void Game::moveEnemiesWithBFS() {
         // Check if position changed (enemy is moving)
         if (nextPos.first != enemy.x || nextPos.second != enemy.y) {
             // Make sure no other enemy is at that position
-            bool occupied = false;
-            for (const auto& other : enemies) {
-                if (&other != &enemy && other.x == nextPos.first && other.y == nextPos.second) {
-                    occupied = true;
-                    break;
-                }
-            }
+            const int target = tileKey(nextPos.first, nextPos.second);
             
             // Move enemy if position is free
-            if (!occupied) {
+            if (!occupied.contains(target)) {
+                int& from = occupied[tileKey(enemy.x, enemy.y)];
+                if (--from == 0) {
+                    occupied.remove(tileKey(enemy.x, enemy.y));
+                }
+                occupied[target]++;
                 enemy.x = nextPos.first;
                 enemy.y = nextPos.second;
             }
@@ -925,6 +941,12 @@ void Game::render() {
         currentState == GameState::SkillTree ||
         currentState == GameState::GameOver) {
         
+        // CHANGE: 2026-10-16 - Camera follows the player; world layers below skip off-camera tiles
+        if (player && dungeon) {
+            renderer->updateCamera(*player, *dungeon);
+        }
+        const TileRect visible = renderer->getVisibleTiles();
+        
         if (dungeon) {
             renderer->renderDungeon(*dungeon, currentFloor);
         }
@@ -939,11 +961,13 @@ void Game::render() {
         }
         
         if (enemyManager) {
-            renderer->renderEnemies(*enemyManager);
+            renderer->renderEnemies(*enemyManager, dungeon ? &dungeon->getFieldOfView() : nullptr);
         }
         
         // CHANGE: 2025-11-10 - Render loot items on ground
         for (const auto& loot : loots) {
+            if (!visible.contains(loot.getX(), loot.getY())) continue;
+            
             sf::Texture* iconTexture = AssetManager::getInstance().getTexture(loot.getItem().id);
             loot.render(window, 32.0f, iconTexture);
             
@@ -1011,6 +1035,7 @@ void Game::render() {
             if (enemyManager) {
                 const auto& enemies = enemyManager->getEnemies();
                 for (const auto& enemy : enemies) {
+                    if (!visible.contains(enemy.x, enemy.y)) continue;
                     sf::RectangleShape enemyBox(sf::Vector2f(32.0f, 32.0f));
                     enemyBox.setPosition(sf::Vector2f(enemy.x * 32.0f, enemy.y * 32.0f));
                     enemyBox.setFillColor(sf::Color::Transparent);
@@ -1024,6 +1049,7 @@ void Game::render() {
         // CHANGE: 2025-11-14 - Debug rendering: Loot item bounds
         if (debugShowBoundingBoxes) {
             for (const auto& loot : loots) {
+                if (!visible.contains(loot.getX(), loot.getY())) continue;
                 sf::RectangleShape lootBox(sf::Vector2f(32.0f, 32.0f));
                 lootBox.setPosition(sf::Vector2f(loot.getX() * 32.0f, loot.getY() * 32.0f));
                 lootBox.setFillColor(sf::Color::Transparent);
@@ -1033,6 +1059,11 @@ void Game::render() {
             }
         }
         
+        // CHANGE: 2026-10-16 - Fog of war over everything on the ground, from the player's sight
+        if (dungeon) {
+            renderer->renderFog(*dungeon);
+        }
+        
         // Apply lighting effect (dark overlay with light around player)
         if (player && renderer->isLightingEnabled()) {
             renderer->applyLighting(*player);
@@ -1335,8 +1366,20 @@ void Game::nextFloor() {
                                 player->getPosition().x * 32.0f, player->getPosition().y * 32.0f, 
                                 sf::Color(255, 255, 255));
     
-    // Generate new level using level manager
-    levelManager->generateLevel(currentFloor, *dungeon, *enemyManager, *player);
+    // CHANGE: 2026-10-16 - Swap in the floor built in the background (waits if the build is
+    // still running); generate synchronously only if nothing was prepared
+    std::unique_ptr<PreparedFloor> prepared = floorPreloader ? floorPreloader->take(currentFloor) : nullptr;
+    if (prepared) {
+        dungeon = std::move(prepared->dungeon);
+        enemyManager = std::move(prepared->enemies);
+    } else {
+        levelManager->generateLevel(currentFloor, *dungeon, *enemyManager, *player);
+    }
+    
+    // Start on the floor after this one
+    if (floorPreloader && currentFloor < levelManager->getMaxFloors()) {
+        floorPreloader->request(currentFloor + 1);
+    }
     
     // Reset player to start position
     auto rooms = dungeon->getRooms();
@@ -1353,7 +1396,8 @@ void Game::nextFloor() {
 void Game::dropItemFromEnemy(const std::string& enemyName, int x, int y) {
     // CHANGE: 2025-11-14 - Unified to use ItemNew system only (deprecated old Item)
     // Random chance for item drop (50% for regular enemies, 100% for bosses)
-    int dropChance = rand() % 100;
+    RandomStream& rng = Random::getInstance().shared(RandomDomain::Loot);
+    int dropChance = static_cast<int>(rng.below(100));
     bool isBoss = (enemyName.find("Dragon") != std::string::npos || 
                    enemyName.find("Knight") != std::string::npos ||
                    enemyName.find("Lich") != std::string::npos ||
@@ -1365,7 +1409,7 @@ void Game::dropItemFromEnemy(const std::string& enemyName, int x, int y) {
         // Floor-based loot table (ItemNew system)
         if (currentFloor <= 2) {
             // Early floors: Basic items
-            int itemRoll = rand() % 100;
+            int itemRoll = static_cast<int>(rng.below(100));
             if (itemRoll < 40) {
                 droppedItem = ItemNew("potion", "Health Potion", "consumable", 1, 50,
                     ItemAction("heal", {{{"amount", 50}}}));
@@ -1378,7 +1422,7 @@ void Game::dropItemFromEnemy(const std::string& enemyName, int x, int y) {
             }
         } else if (currentFloor <= 4) {
             // Mid floors: Better items
-            int itemRoll = rand() % 100;
+            int itemRoll = static_cast<int>(rng.below(100));
             if (itemRoll < 30) {
                 droppedItem = ItemNew("potion_mega", "Mega Potion", "consumable", 2, 75,
                     ItemAction("heal", {{{"amount", 150}}}));
@@ -1395,7 +1439,7 @@ void Game::dropItemFromEnemy(const std::string& enemyName, int x, int y) {
             }
         } else if (currentFloor <= 7) {
             // Deep floors: Advanced items
-            int itemRoll = rand() % 100;
+            int itemRoll = static_cast<int>(rng.below(100));
             if (itemRoll < 25) {
                 droppedItem = ItemNew("elixir", "Elixir", "consumable", 3, 150,
                     ItemAction("heal", {{{"amount", 100}}}));
@@ -1412,7 +1456,7 @@ void Game::dropItemFromEnemy(const std::string& enemyName, int x, int y) {
             }
         } else {
             // Legendary floors: Epic loot
-            int itemRoll = rand() % 100;
+            int itemRoll = static_cast<int>(rng.below(100));
             if (itemRoll < 20) {
                 droppedItem = ItemNew("revive_scroll", "Scroll of Resurrection", "utility", 5, 500);
             } else if (itemRoll < 40) {
@@ -1463,7 +1507,14 @@ void Game::updateCombatEffects(float deltaTime) {
 void Game::renderCombatEffects() {
     if (!renderer) return;
     
+    const TileRect visible = renderer->getVisibleTiles();
     for (const auto& effect : activeEffects) {
+        // Effects are placed in world pixels
+        if (!visible.contains(static_cast<int>(std::floor(effect.x / 32.0f)),
+                              static_cast<int>(std::floor(effect.y / 32.0f)))) {
+            continue;
+        }
+        
         // Get appropriate texture based on effect type
         std::string textureKey;
         
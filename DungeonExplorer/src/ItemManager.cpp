@@ -26,12 +26,14 @@ void ItemManager::loadItems(const std::string& path) {
         return;
     }
     
+    itemDB.reserve(itemDB.size() + j["items"].size());
+    
     int loadedCount = 0;
     for (const auto& itemJson : j["items"]) {
         ItemNew item = itemNewFromJson(itemJson);
         
         // Insert into hash table
-        itemDB[item.id] = item;
+        itemDB.insert(item.id, item);
         
         // Load icon texture into AssetManager
         if (!item.iconPath.empty()) {
@@ -49,10 +51,9 @@ void ItemManager::loadItems(const std::string& path) {
     std::cout << "[ItemManager] Successfully loaded " << loadedCount << " items into hash table" << std::endl;
 }
 
-ItemNew ItemManager::getItemById(const std::string& id) const {
-    auto it = itemDB.find(id);
-    if (it != itemDB.end()) {
-        return it->second;
+ItemNew ItemManager::getItemById(std::string_view id) const {
+    if (const ItemNew* item = itemDB.find(id)) {
+        return *item;
     }
     
     std::cerr << "[ERROR] Item not found: " << id << std::endl;
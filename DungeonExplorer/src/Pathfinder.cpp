@@ -0,0 +1,288 @@
+#include "Pathfinder.h"
+#include "BitScan.h"
+#include "GridSteps.h"
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+    int sign(int v) {
+        return (v > 0) - (v < 0);
+    }
+}
+
+Pathfinder::Pathfinder() : map(nullptr), mapWidth(0), mapHeight(0), chunksX(0), generation(0),
+                           goalX(-1), goalY(-1), lastExpanded(0) {
+}
+
+void Pathfinder::reset() {
+    map = nullptr;
+    mapWidth = 0;
+    mapHeight = 0;
+    chunksX = 0;
+    chunkSlot.clear();
+    slotChunk.clear();
+    nodes.clear();
+    generation = 0;
+}
+
+void Pathfinder::bind(const ChunkedTileMap& target) {
+    if (map == &target && mapWidth == target.width() && mapHeight == target.height()) {
+        return;
+    }
+    
+    reset();
+    map = &target;
+    mapWidth = target.width();
+    mapHeight = target.height();
+    chunksX = target.chunkCountX();
+    chunkSlot.assign(static_cast<size_t>(chunksX) * target.chunkCountY(), NO_CELL);
+}
+
+uint32_t Pathfinder::cellIndex(int x, int y) {
+    const size_t chunk = static_cast<size_t>(y >> ChunkedTileMap::CHUNK_SHIFT) * chunksX +
+                         (x >> ChunkedTileMap::CHUNK_SHIFT);
+    uint32_t slot = chunkSlot[chunk];
+    if (slot == NO_CELL) {
+        // First search to reach this chunk: the only time the buffers grow
+        slot = static_cast<uint32_t>(slotChunk.size());
+        chunkSlot[chunk] = slot;
+        slotChunk.push_back(static_cast<uint32_t>(chunk));
+        nodes.resize(nodes.size() + ChunkedTileMap::CHUNK_TILES, NodeState{0, INF, NO_CELL});
+    }
+    return slot * ChunkedTileMap::CHUNK_TILES +
+           (((y & ChunkedTileMap::CHUNK_MASK) << ChunkedTileMap::CHUNK_SHIFT) | (x & ChunkedTileMap::CHUNK_MASK));
+}
+
+void Pathfinder::cellPosition(uint32_t cell, int& x, int& y) const {
+    const uint32_t chunk = slotChunk[cell / ChunkedTileMap::CHUNK_TILES];
+    const uint32_t local = cell % ChunkedTileMap::CHUNK_TILES;
+    x = static_cast<int>(chunk % chunksX) * ChunkedTileMap::CHUNK_SIZE + static_cast<int>(local & ChunkedTileMap::CHUNK_MASK);
+    y = static_cast<int>(chunk / chunksX) * ChunkedTileMap::CHUNK_SIZE + static_cast<int>(local >> ChunkedTileMap::CHUNK_SHIFT);
+}
+
+Pathfinder::NodeState& Pathfinder::touch(uint32_t cell) {
+    NodeState& node = nodes[cell];
+    if (node.stamp != generation) {
+        node.stamp = generation;
+        node.g = INF;
+        node.parent = NO_CELL;
+    }
+    return node;
+}
+
+uint32_t Pathfinder::heuristic(int x, int y) const {
+    return static_cast<uint32_t>(std::abs(x - goalX) + std::abs(y - goalY));
+}
+
+void Pathfinder::relax(uint32_t from, int x, int y, uint32_t g) {
+    const uint32_t cell = cellIndex(x, y);
+    NodeState& node = touch(cell);
+    if (g < node.g) {
+        node.g = g;
+        node.parent = from;
+        open.push(g + heuristic(x, y), cell);
+    }
+}
+
+uint64_t Pathfinder::passableWord(int baseX, int y) const {
+    if (baseX < 0 || baseX >= mapWidth || y < 0 || y >= mapHeight) return 0;
+    uint64_t word = map->walkWord(baseX, y);
+    if (y == goalY && (goalX & ~ChunkedTileMap::CHUNK_MASK) == baseX) {
+        word |= uint64_t(1) << (goalX & ChunkedTileMap::CHUNK_MASK);
+    }
+    return word;
+}
+
+// Scans 64 tiles per step using the walk words: a tile stops the jump if it is blocked,
+// is the goal, or has a forced neighbour (a wall behind us above/below ends here, so a
+// vertical route opens up).
+bool Pathfinder::jumpHorizontal(int& x, int y, int dx) const {
+    const uint64_t ALL = ~uint64_t(0);
+    const int step = dx * ChunkedTileMap::CHUNK_SIZE;
+    int base = (x + dx) & ~ChunkedTileMap::CHUNK_MASK;
+    
+    // Rows above/below of the word we came from; its edge bit is "behind" our first tile
+    uint64_t upPrev = passableWord(base - step, y - 1);
+    uint64_t downPrev = passableWord(base - step, y + 1);
+    
+    while (base >= 0 && base < mapWidth) {
+        const uint64_t here = passableWord(base, y);
+        const uint64_t up = passableWord(base, y - 1);
+        const uint64_t down = passableWord(base, y + 1);
+        uint64_t upBehind, downBehind;
+        uint64_t ahead;  // Tiles of this word that lie beyond x in the direction of travel
+        
+        if (dx > 0) {
+            upBehind = (up << 1) | (upPrev >> 63);
+            downBehind = (down << 1) | (downPrev >> 63);
+            ahead = x < base ? ALL : (ALL << (x - base)) << 1;
+        } else {
+            upBehind = (up >> 1) | (upPrev << 63);
+            downBehind = (down >> 1) | (downPrev << 63);
+            ahead = x >= base + ChunkedTileMap::CHUNK_SIZE ? ALL : ~(ALL << (x - base));
+        }
+        
+        uint64_t stop = ~here | (up & ~upBehind) | (down & ~downBehind);
+        if (y == goalY && (goalX & ~ChunkedTileMap::CHUNK_MASK) == base) {
+            stop |= uint64_t(1) << (goalX & ChunkedTileMap::CHUNK_MASK);
+        }
+        
+        stop &= ahead;
+        if (stop != 0) {
+            const int stopX = base + (dx > 0 ? lowestBit(stop) : highestBit(stop));
+            if (stopX >= mapWidth || !((here >> (stopX - base)) & 1)) return false;  // Hit a wall
+            x = stopX;
+            return true;
+        }
+        
+        upPrev = up;
+        downPrev = down;
+        base += step;
+    }
+    return false;
+}
+
+bool Pathfinder::jumpVertical(int x, int& y, int dy) const {
+    while (true) {
+        y += dy;
+        if (!passable(x, y)) return false;
+        if (x == goalX && y == goalY) return true;
+        
+        if ((passable(x - 1, y) && !passable(x - 1, y - dy)) ||
+            (passable(x + 1, y) && !passable(x + 1, y - dy))) {
+            return true;
+        }
+        
+        // Vertical moves also stop where a horizontal jump would find something
+        int probeX = x;
+        if (jumpHorizontal(probeX, y, 1)) return true;
+        probeX = x;
+        if (jumpHorizontal(probeX, y, -1)) return true;
+    }
+}
+
+bool Pathfinder::search(int startX, int startY, Method method) {
+    if (++generation == 0) {
+        // Stamp wrapped: every entry could look current, so clear them once
+        for (NodeState& node : nodes) node.stamp = 0;
+        generation = 1;
+    }
+    open.clear();
+    lastExpanded = 0;
+    
+    const uint32_t startCell = cellIndex(startX, startY);
+    const uint32_t goalCell = cellIndex(goalX, goalY);
+    NodeState& start = touch(startCell);
+    start.g = 0;
+    open.push(heuristic(startX, startY), startCell);
+    
+    while (!open.isEmpty()) {
+        const auto [f, cell] = open.pop();
+        int x, y;
+        cellPosition(cell, x, y);
+        
+        // relax() can grow 'nodes', so copy what we need instead of holding a reference
+        const uint32_t g = nodes[cell].g;
+        const uint32_t parent = nodes[cell].parent;
+        if (f > g + heuristic(x, y)) continue;  // Stale entry; a cheaper one was expanded already
+        
+        lastExpanded++;
+        if (cell == goalCell) return true;
+        
+        if (method == Method::AStar) {
+            for (int dir = 0; dir < 4; dir++) {
+                const int nx = x + STEP_X[dir];
+                const int ny = y + STEP_Y[dir];
+                if (passable(nx, ny)) relax(cell, nx, ny, g + 1);
+            }
+            continue;
+        }
+        
+        // JPS: from the start try every direction; elsewhere only the directions that
+        // the parent could not have reached as cheaply (straight on and the two sides)
+        if (parent == NO_CELL) {
+            for (int dir = 0; dir < 4; dir++) {
+                int jx = x, jy = y;
+                bool found = STEP_X[dir] != 0 ? jumpHorizontal(jx, y, STEP_X[dir])
+                                              : jumpVertical(x, jy, STEP_Y[dir]);
+                if (found) relax(cell, jx, jy, g + std::abs(jx - x) + std::abs(jy - y));
+            }
+            continue;
+        }
+        
+        int px, py;
+        cellPosition(parent, px, py);
+        const int dx = sign(x - px);
+        const int dy = sign(y - py);
+        int dirX[3], dirY[3];
+        int dirCount = 0;
+        if (dx != 0) {
+            dirX[dirCount] = 0;  dirY[dirCount++] = -1;
+            dirX[dirCount] = 0;  dirY[dirCount++] = 1;
+            dirX[dirCount] = dx; dirY[dirCount++] = 0;
+        } else {
+            dirX[dirCount] = -1; dirY[dirCount++] = 0;
+            dirX[dirCount] = 1;  dirY[dirCount++] = 0;
+            dirX[dirCount] = 0;  dirY[dirCount++] = dy;
+        }
+        
+        for (int i = 0; i < dirCount; i++) {
+            int jx = x, jy = y;
+            bool found = dirX[i] != 0 ? jumpHorizontal(jx, y, dirX[i]) : jumpVertical(x, jy, dirY[i]);
+            if (found) relax(cell, jx, jy, g + std::abs(jx - x) + std::abs(jy - y));
+        }
+    }
+    return false;
+}
+
+bool Pathfinder::findPath(const ChunkedTileMap& target, int startX, int startY, int targetX, int targetY,
+                          std::vector<std::pair<int, int>>& path, Method method) {
+    path.clear();
+    if (!target.inBounds(startX, startY) || !target.inBounds(targetX, targetY)) return false;
+    
+    bind(target);
+    goalX = targetX;
+    goalY = targetY;
+    if (startX == goalX && startY == goalY) return true;
+    if (!search(startX, startY, method)) return false;
+    
+    // Walk the parent chain back from the goal, filling in the tiles a jump skipped
+    uint32_t cell = cellIndex(goalX, goalY);
+    int x, y;
+    cellPosition(cell, x, y);
+    while (nodes[cell].parent != NO_CELL) {
+        int px, py;
+        cellPosition(nodes[cell].parent, px, py);
+        const int dx = sign(px - x);
+        const int dy = sign(py - y);
+        while (x != px || y != py) {
+            path.emplace_back(x, y);
+            x += dx;
+            y += dy;
+        }
+        cell = nodes[cell].parent;
+    }
+    std::reverse(path.begin(), path.end());
+    return true;
+}
+
+std::pair<int, int> Pathfinder::nextStep(const ChunkedTileMap& target, int startX, int startY,
+                                         int targetX, int targetY, Method method) {
+    if (!target.inBounds(startX, startY) || !target.inBounds(targetX, targetY)) return {startX, startY};
+    
+    bind(target);
+    goalX = targetX;
+    goalY = targetY;
+    if (startX == goalX && startY == goalY) return {startX, startY};
+    if (!search(startX, startY, method)) return {startX, startY};
+    
+    // Node right after the start; under JPS that is a jump point, so step one tile toward it
+    uint32_t cell = cellIndex(goalX, goalY);
+    const uint32_t startCell = cellIndex(startX, startY);
+    while (nodes[cell].parent != startCell) {
+        cell = nodes[cell].parent;
+    }
+    int x, y;
+    cellPosition(cell, x, y);
+    return {startX + sign(x - startX), startY + sign(y - startY)};
+}
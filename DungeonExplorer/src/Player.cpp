@@ -5,6 +5,7 @@
 
 #include "Player.h"
 #include "AssetManager.h"
+#include "Random.h"
 #include <iostream>
 #include <algorithm>  // For std::clamp
 
@@ -29,8 +30,7 @@ Player::~Player() {
 
 void Player::initialize(int startX, int startY) {
     position = Position(startX, startY);
-    pathHistory.clear();
-    pathHistory.push(position);
+    pathHistory.reset(position);
     
     std::cout << "[Player] " << name << " the " << characterClass << " initialized at position (" 
               << startX << ", " << startY << ")" << std::endl;
@@ -75,15 +75,15 @@ void Player::move(int dx, int dy) {
 }
 
 void Player::moveTo(const Position& pos) {
-    pathHistory.push(position);  // Stack: Save current position before moving
+    pathHistory.record(pos);  // History: remember the move so it can be undone
     position = pos;
     std::cout << "[Player] Moved to (" << pos.x << ", " << pos.y << ")" << std::endl;
 }
 
 void Player::backtrack() {
-    if (pathHistory.size() > 1) {
-        pathHistory.pop();  // Remove current position
-        position = pathHistory.top();  // Go back to previous
+    // CHANGE: 2026-10-16 - Undo exactly the last move (popping then reading top skipped one)
+    if (pathHistory.backtrack()) {
+        position = pathHistory.current();
         std::cout << "[Player] Backtracked to (" << position.x << ", " << position.y << ")" << std::endl;
     } else {
         std::cout << "[Player] Cannot backtrack - at starting position" << std::endl;
@@ -110,7 +110,7 @@ bool Player::removeItem(const ItemNew& item) {
 
 int Player::attackEnemy() {
     // Base damage is attack stat + random variance
-    int damage = attack + (rand() % 5);
+    int damage = attack + static_cast<int>(Random::getInstance().shared(RandomDomain::Combat).below(5));
     std::cout << "[Player] " << name << " attacks for " << damage << " damage!" << std::endl;
     return damage;
 }
@@ -149,14 +149,12 @@ void Player::heal(int amount) {
 
 bool Player::usePotion() {
     // CHANGE: 2025-11-14 - Check for potion in ItemNew system
-    bool hasPotion = false;
-    inventoryNew.traverse([&](const ItemNew& item) {
-        if (item.type == "consumable" && item.action.kind == "heal") {
-            hasPotion = true;
-        }
+    // CHANGE: 2026-10-16 - Single early-exit scan with find_if
+    auto potion = inventoryNew.find_if([](const ItemNew& item) {
+        return item.type == "consumable" && item.action.kind == "heal";
     });
     
-    if (!hasPotion) {
+    if (potion == inventoryNew.end()) {
         std::cout << "[Player] No potions in inventory!" << std::endl;
         return false;
     }
@@ -167,34 +165,25 @@ bool Player::usePotion() {
         return false;
     }
     
-    // Find and use first healing potion - we need a mutable version
-    bool used = false;
-    // Since traverse is const, we need to manually find and remove
-    inventoryNew.traverse([&](const ItemNew& item) {
-        if (!used && item.type == "consumable" && item.action.kind == "heal") {
-            int healAmount = 50;  // Default heal amount
-            if (item.action.params.contains("amount")) {
-                healAmount = item.action.params["amount"].get<int>();
-            }
-            heal(healAmount);
-            std::cout << "[Player] Used " << item.name << "! (+" << healAmount << " HP)" << std::endl;
-            removeItemNew(item.id);
-            used = true;
-        }
-    });
+    // Use the first healing potion (removed after the iterator is no longer needed)
+    int healAmount = 50;  // Default heal amount
+    if (potion->action.params.contains("amount")) {
+        healAmount = potion->action.params["amount"].get<int>();
+    }
+    heal(healAmount);
+    std::cout << "[Player] Used " << potion->name << "! (+" << healAmount << " HP)" << std::endl;
+    std::string potionId = potion->id;
+    removeItemNew(potionId);
     
-    return used;
+    return true;
 }
 
 // CHANGE: 2025-11-14 - Unified hasItem to work with ItemNew
 bool Player::hasItem(const std::string& itemName) const {
-    bool found = false;
-    inventoryNew.traverse([&](const ItemNew& item) {
-        if (item.name == itemName || item.id == itemName) {
-            found = true;
-        }
+    auto it = inventoryNew.find_if([&](const ItemNew& item) {
+        return item.name == itemName || item.id == itemName;
     });
-    return found;
+    return it != inventoryNew.end();
 }
 
 void Player::addExperience(int xp) {
@@ -330,19 +319,15 @@ bool Player::spendGold(int amount) {
 }
 
 bool Player::removeItemNew(const std::string& itemId) {
-    bool found = false;
-    ItemNew toRemove;
-    
-    inventoryNew.traverse([&](const ItemNew& item) {
-        if (item.id == itemId) {
-            toRemove = item;
-            found = true;
-        }
+    std::string removedName;
+    bool found = inventoryNew.removeFirstIf([&](const ItemNew& item) {
+        if (item.id != itemId) return false;
+        removedName = item.name;
+        return true;
     });
     
     if (found) {
-        inventoryNew.remove(toRemove);
-        std::cout << "[Player] Removed " << toRemove.name << " from inventory" << std::endl;
+        std::cout << "[Player] Removed " << removedName << " from inventory" << std::endl;
         return true;
     }
     return false;
@@ -350,20 +335,14 @@ bool Player::removeItemNew(const std::string& itemId) {
 
 bool Player::useItem(const std::string& itemId) {
     // Find the item in inventory
-    bool found = false;
-    ItemNew itemToUse;
-    
-    inventoryNew.traverse([&](const ItemNew& item) {
-        if (item.id == itemId) {
-            itemToUse = item;
-            found = true;
-        }
-    });
+    auto it = inventoryNew.find_if([&](const ItemNew& item) { return item.id == itemId; });
     
-    if (!found) {
+    if (it == inventoryNew.end()) {
         std::cout << "[Player] Item " << itemId << " not found in inventory!" << std::endl;
         return false;
     }
+    // Copy: the node is freed by removeItemNew() below, but the item is still needed
+    ItemNew itemToUse = *it;
     
     std::cout << "[DEBUG] Using item: " << itemToUse.name << " (type: " << itemToUse.type 
               << ", action: " << itemToUse.action.kind << ")" << std::endl;
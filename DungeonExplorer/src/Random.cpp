@@ -0,0 +1,51 @@
+#include "Random.h"
+#include <chrono>
+#include <iostream>
+#include <random>
+
+namespace {
+    // SplitMix64 finalizer: folds one more value into a running hash
+    uint64_t mix(uint64_t hash, uint64_t value) {
+        uint64_t z = hash ^ (value + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2));
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+}
+
+Random& Random::getInstance() {
+    static Random instance;
+    return instance;
+}
+
+Random::Random() : runSeed(seedFromClock()) {
+    resetSharedStreams();
+}
+
+void Random::resetSharedStreams() {
+    // Floor ~0 keeps the shared streams apart from every per-floor stream
+    for (uint64_t domain = 0; domain < static_cast<uint64_t>(RandomDomain::Count); domain++) {
+        sharedStreams[domain] = stream(static_cast<RandomDomain>(domain), ~uint64_t(0));
+    }
+}
+
+void Random::seed(uint64_t newSeed) {
+    runSeed = newSeed;
+    resetSharedStreams();
+    std::cout << "[Random] Run seed: " << runSeed << " (replay with --seed " << runSeed << ")" << std::endl;
+}
+
+RandomStream Random::stream(RandomDomain domain, uint64_t floor, uint64_t index) const {
+    uint64_t hash = mix(runSeed, static_cast<uint64_t>(domain));
+    hash = mix(hash, floor);
+    hash = mix(hash, index);
+    return RandomStream(hash);
+}
+
+uint64_t Random::seedFromClock() {
+    // Called once per run, so the random_device cost does not matter here
+    std::random_device device;
+    const uint64_t entropy = (static_cast<uint64_t>(device()) << 32) | device();
+    const uint64_t ticks = static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    return mix(entropy, ticks);
+}
@@ -4,6 +4,7 @@
 #include "Enemy.h"
 #include <iostream>
 #include <cmath>
+#include <algorithm>
 
 Renderer::Renderer(sf::RenderWindow* window, float tileSize)
     : window(window), tileSize(tileSize), 
@@ -27,6 +28,7 @@ Renderer::Renderer(sf::RenderWindow* window, float tileSize)
 
 void Renderer::begin() {
     window->clear(sf::Color::Black);
+    setUIView();  // Screens without a world (menus) draw in window pixels
 }
 
 void Renderer::end() {
@@ -43,9 +45,14 @@ void Renderer::renderPlayer(const Player& player) {
     player.render(*window, tileSize);
 }
 
-void Renderer::renderEnemies(const EnemyManager& enemyManager) {
+void Renderer::renderEnemies(const EnemyManager& enemyManager, const FieldOfView* sight) {
     setGameView();
-    enemyManager.render(*window, tileSize);
+    enemyManager.render(*window, tileSize, getVisibleTiles(), sight);
+}
+
+void Renderer::renderFog(const Dungeon& dungeon) {
+    setGameView();
+    dungeon.renderFog(*window, tileSize);
 }
 
 void Renderer::setGameView() {
@@ -56,12 +63,40 @@ void Renderer::setUIView() {
     window->setView(uiView);
 }
 
+void Renderer::updateCamera(const Player& player, const Dungeon& dungeon) {
+    const sf::Vector2f viewSize = gameView.getSize();
+    const Position playerPos = player.getPosition();
+    
+    auto follow = [](float target, float view, float map) {
+        if (map <= view) return view / 2.0f;
+        return std::clamp(target, view / 2.0f, map - view / 2.0f);
+    };
+    
+    // Whole pixels, so tile edges don't shimmer while scrolling
+    gameView.setCenter(sf::Vector2f(
+        std::round(follow((playerPos.x + 0.5f) * tileSize, viewSize.x, dungeon.getWidth() * tileSize)),
+        std::round(follow((playerPos.y + 0.5f) * tileSize, viewSize.y, dungeon.getHeight() * tileSize))));
+}
+
+TileRect Renderer::getVisibleTiles() const {
+    const sf::Vector2f center = gameView.getCenter();
+    const sf::Vector2f halfSize = gameView.getSize() / 2.0f;
+    
+    // The margin keeps sprites that overhang their tile (shadows, labels) from popping at the edge
+    return TileRect(static_cast<int>(std::floor((center.x - halfSize.x) / tileSize)) - 1,
+                    static_cast<int>(std::floor((center.y - halfSize.y) / tileSize)) - 1,
+                    static_cast<int>(std::floor((center.x + halfSize.x) / tileSize)) + 1,
+                    static_cast<int>(std::floor((center.y + halfSize.y) / tileSize)) + 1);
+}
+
 sf::Vector2f Renderer::worldToScreen(float x, float y) const {
-    return sf::Vector2f(x * tileSize, y * tileSize);
+    const sf::Vector2f topLeft = gameView.getCenter() - gameView.getSize() / 2.0f;
+    return sf::Vector2f(x * tileSize - topLeft.x, y * tileSize - topLeft.y);
 }
 
 sf::Vector2f Renderer::screenToWorld(float x, float y) const {
-    return sf::Vector2f(x / tileSize, y / tileSize);
+    const sf::Vector2f topLeft = gameView.getCenter() - gameView.getSize() / 2.0f;
+    return sf::Vector2f((x + topLeft.x) / tileSize, (y + topLeft.y) / tileSize);
 }
 
 bool Renderer::loadLightingShader() {
@@ -96,6 +131,9 @@ void Renderer::applyLighting(const Player& player) {
         return;
     }
     
+    // The overlay covers the window, so it is drawn in window pixels
+    setUIView();
+    
     // Get player position in screen coordinates
     Position playerPos = player.getPosition();
     sf::Vector2f screenPos = worldToScreen(static_cast<float>(playerPos.x), static_cast<float>(playerPos.y));
@@ -160,4 +198,6 @@ void Renderer::applyLighting(const Player& player) {
         }
         window->draw(outerGlow, sf::BlendAdd);
     }
+    
+    setGameView();
 }
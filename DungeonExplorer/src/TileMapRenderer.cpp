@@ -0,0 +1,342 @@
+// CHANGE: 2026-10-16 - Chunked vertex-array tile layer (see TileMapRenderer.h)
+// Tile styling (textures per floor theme, fallback colours, stair sparkles) is unchanged
+// from the old per-tile Dungeon::render loop; only how it reaches the GPU differs.
+
+#include "TileMapRenderer.h"
+#include "Dungeon.h"
+#include "AssetManager.h"
+#include "FieldOfView.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Two triangles covering [left, left + width) x [top, top + height)
+    void appendQuad(sf::VertexArray& vertices, float left, float top, float width, float height,
+                    sf::Color color, sf::Vector2f texSize = sf::Vector2f(0.0f, 0.0f)) {
+        auto corner = [&](float px, float py, float tx, float ty) {
+            sf::Vertex vertex;
+            vertex.position = sf::Vector2f(left + px * width, top + py * height);
+            vertex.color = color;
+            vertex.texCoords = sf::Vector2f(tx * texSize.x, ty * texSize.y);
+            vertices.append(vertex);
+        };
+        corner(0, 0, 0, 0);
+        corner(1, 0, 1, 0);
+        corner(0, 1, 0, 1);
+        corner(0, 1, 0, 1);
+        corner(1, 0, 1, 0);
+        corner(1, 1, 1, 1);
+    }
+    
+    sf::Color fallbackColor(TileType tile) {
+        switch (tile) {
+            case TileType::Empty:    return sf::Color(15, 15, 20);    // Dark void
+            case TileType::Wall:     return sf::Color(60, 60, 70);    // Stone gray
+            case TileType::Floor:    return sf::Color(80, 70, 60);    // Brown floor
+            case TileType::Start:    return sf::Color(50, 100, 200);  // Bright blue
+            case TileType::Exit:     return sf::Color(255, 200, 50);  // Golden exit
+            case TileType::Door:     return sf::Color(150, 120, 60);  // Gold trim
+            case TileType::Treasure: return sf::Color(255, 215, 0);   // Gold
+            case TileType::Enemy:    return sf::Color(120, 40, 40);   // Dark red
+        }
+        return sf::Color(15, 15, 20);
+    }
+}
+
+TileMapRenderer::TileMapRenderer()
+    : chunksX(0), chunksY(0), mapWidth(0), mapHeight(0), meshTileSize(0.0f), meshFloor(0),
+      sparkleTexture(nullptr), texturesResolved(false), lastDrawCalls(0), builtChunks(0),
+      lruNewest(-1), lruOldest(-1), frame(0), residentBytes(0), memoryBudget(DEFAULT_MEMORY_BUDGET), evictedChunks(0) {
+    textures.fill(nullptr);
+}
+
+void TileMapRenderer::reset() {
+    meshes.clear();
+    builtChunks = 0;
+    lruNewest = -1;
+    lruOldest = -1;
+    residentBytes = 0;
+    evictedChunks = 0;
+}
+
+void TileMapRenderer::markDirty(int x, int y) {
+    if (meshes.empty() || x < 0 || y < 0) return;
+    const int chunkX = x >> ChunkedTileMap::CHUNK_SHIFT;
+    const int chunkY = y >> ChunkedTileMap::CHUNK_SHIFT;
+    if (chunkX >= chunksX || chunkY >= chunksY) return;
+    
+    ChunkMesh& mesh = meshes[static_cast<size_t>(chunkY) * chunksX + chunkX];
+    if (mesh.built) {
+        mesh.built = false;
+        builtChunks--;
+    }
+}
+
+void TileMapRenderer::resolveTextures() {
+    AssetManager& assets = AssetManager::getInstance();
+    textures[WallTexture] = assets.getTexture("wall");
+    textures[FloorTexture] = assets.getTexture("floor");
+    textures[FloorVariant1] = assets.getTexture("floor_variant_1");
+    textures[FloorVariant2] = assets.getTexture("floor_variant_2");
+    textures[FloorVariant3] = assets.getTexture("floor_variant_3");
+    textures[FloorVariant4] = assets.getTexture("floor_variant_4");
+    textures[StairsDownTexture] = assets.getTexture("stairs_down");
+    textures[StairsUpTexture] = assets.getTexture("stairs_up");
+    textures[DoorTexture] = assets.getTexture("door_closed");
+    textures[ChestTexture] = assets.getTexture("chest");
+    sparkleTexture = assets.getTexture("effect_sparkle");
+    texturesResolved = true;
+}
+
+void TileMapRenderer::bind(const ChunkedTileMap& map, float tileSize, int currentFloor) {
+    if (!texturesResolved) {
+        resolveTextures();
+    }
+    
+    if (!meshes.empty() && map.width() == mapWidth && map.height() == mapHeight &&
+        tileSize == meshTileSize && currentFloor == meshFloor) {
+        return;
+    }
+    
+    mapWidth = map.width();
+    mapHeight = map.height();
+    chunksX = map.chunkCountX();
+    chunksY = map.chunkCountY();
+    meshTileSize = tileSize;
+    meshFloor = currentFloor;
+    reset();
+    meshes.resize(static_cast<size_t>(chunksX) * chunksY);
+}
+
+void TileMapRenderer::unlink(int index) {
+    ChunkMesh& mesh = meshes[index];
+    if (mesh.newer >= 0) meshes[mesh.newer].older = mesh.older;
+    else lruNewest = mesh.older;
+    if (mesh.older >= 0) meshes[mesh.older].newer = mesh.newer;
+    else lruOldest = mesh.newer;
+    mesh.newer = -1;
+    mesh.older = -1;
+}
+
+void TileMapRenderer::touch(int index) {
+    if (lruNewest == index) return;
+    
+    ChunkMesh& mesh = meshes[index];
+    if (mesh.resident) {
+        unlink(index);
+    }
+    mesh.resident = true;
+    mesh.older = lruNewest;
+    if (lruNewest >= 0) meshes[lruNewest].newer = index;
+    lruNewest = index;
+    if (lruOldest < 0) lruOldest = index;
+}
+
+void TileMapRenderer::evict(int index) {
+    ChunkMesh& mesh = meshes[index];
+    unlink(index);
+    for (sf::VertexArray& layer : mesh.layers) {
+        layer = sf::VertexArray();  // clear() would keep the capacity
+    }
+    residentBytes -= mesh.bytes;
+    mesh.bytes = 0;
+    mesh.resident = false;
+    if (mesh.built) {
+        mesh.built = false;
+        builtChunks--;
+    }
+    evictedChunks++;
+}
+
+void TileMapRenderer::trimToBudget() {
+    // Chunks drawn this frame are never evicted, even if they alone exceed the budget
+    while (residentBytes > memoryBudget && lruOldest >= 0 && meshes[lruOldest].lastDrawnFrame != frame) {
+        evict(lruOldest);
+    }
+}
+
+size_t TileMapRenderer::textureSlotFor(uint8_t tile, int x, int y) const {
+    size_t slot = TextureSlotCount;
+    
+    switch (static_cast<TileType>(tile)) {
+        case TileType::Empty:
+            break;
+        case TileType::Wall:
+            slot = WallTexture;
+            break;
+        case TileType::Floor: {
+            // Randomize floor tile variant based on position (deterministic)
+            const int variant = (x * 7 + y * 13) % 5;
+            if (meshFloor <= 3) {
+                slot = FloorTexture;  // Floors 1-3: all brick
+            } else if (meshFloor <= 6) {
+                slot = variant < 2 ? FloorTexture : FloorVariant2;  // Floors 4-6: brick or rock
+            } else {
+                slot = variant < 3 ? FloorVariant1 : FloorVariant2;  // Floors 7-10: brimstone or rock
+            }
+            break;
+        }
+        case TileType::Start:
+            slot = StairsDownTexture;
+            break;
+        case TileType::Exit:
+            slot = StairsUpTexture;
+            break;
+        case TileType::Door:
+            slot = DoorTexture;
+            break;
+        case TileType::Treasure:
+            slot = ChestTexture;
+            break;
+        case TileType::Enemy: {
+            // Enemy tiles use randomized floor
+            const int variant = (x * 7 + y * 13) % 5;
+            slot = variant == 0 ? FloorTexture : FloorVariant1 + (variant - 1);
+            break;
+        }
+    }
+    
+    if (slot != TextureSlotCount && !textures[slot]) {
+        slot = TextureSlotCount;  // Texture missing: draw the fallback colour
+    }
+    return slot;
+}
+
+void TileMapRenderer::build(ChunkMesh& mesh, const ChunkedTileMap& map, int chunkX, int chunkY) {
+    for (sf::VertexArray& layer : mesh.layers) {
+        layer.setPrimitiveType(sf::PrimitiveType::Triangles);
+        layer.clear();
+    }
+    
+    const float size = meshTileSize;
+    const int x0 = chunkX * ChunkedTileMap::CHUNK_SIZE;
+    const int y0 = chunkY * ChunkedTileMap::CHUNK_SIZE;
+    const int x1 = std::min(x0 + ChunkedTileMap::CHUNK_SIZE, mapWidth);
+    const int y1 = std::min(y0 + ChunkedTileMap::CHUNK_SIZE, mapHeight);
+    
+    for (int y = y0; y < y1; y++) {
+        for (int x = x0; x < x1; x++) {
+            const uint8_t tile = map.get(x, y);
+            const TileType type = static_cast<TileType>(tile);
+            const size_t slot = textureSlotFor(tile, x, y);
+            const float left = x * size;
+            const float top = y * size;
+            
+            if (slot == TextureSlotCount) {
+                // Fallback: coloured square; a darker edge stands in for the old 0.5px outline
+                if (type == TileType::Empty) {
+                    appendQuad(mesh.layers[FALLBACK_LAYER], left, top, size, size, fallbackColor(type));
+                } else {
+                    appendQuad(mesh.layers[FALLBACK_LAYER], left, top, size, size, sf::Color(30, 30, 35));
+                    appendQuad(mesh.layers[FALLBACK_LAYER], left + 0.5f, top + 0.5f, size - 1.0f, size - 1.0f,
+                               fallbackColor(type));
+                }
+                continue;
+            }
+            
+            const sf::Vector2u texSize = textures[slot]->getSize();
+            appendQuad(mesh.layers[slot], left, top, size, size, sf::Color::White,
+                       sf::Vector2f(static_cast<float>(texSize.x), static_cast<float>(texSize.y)));
+            
+            // ✨ Sparkle overlay on stairs (scaled to the tile width, semi-transparent)
+            if ((type == TileType::Start || type == TileType::Exit) && sparkleTexture) {
+                const sf::Vector2u sparkleSize = sparkleTexture->getSize();
+                const float scale = sparkleSize.x > 0 ? size / sparkleSize.x : 0.0f;
+                appendQuad(mesh.layers[SPARKLE_LAYER], left, top, size, sparkleSize.y * scale,
+                           sf::Color(255, 255, 255, 180),
+                           sf::Vector2f(static_cast<float>(sparkleSize.x), static_cast<float>(sparkleSize.y)));
+            }
+        }
+    }
+    
+    residentBytes -= mesh.bytes;
+    mesh.bytes = 0;
+    for (const sf::VertexArray& layer : mesh.layers) {
+        mesh.bytes += layer.getVertexCount() * sizeof(sf::Vertex);
+    }
+    residentBytes += mesh.bytes;
+    
+    mesh.built = true;
+    builtChunks++;
+}
+
+void TileMapRenderer::draw(sf::RenderTarget& target, const ChunkedTileMap& map, float tileSize, int currentFloor) {
+    bind(map, tileSize, currentFloor);
+    lastDrawCalls = 0;
+    frame++;
+    if (meshes.empty() || tileSize <= 0.0f) return;
+    
+    // Chunks overlapping the view rectangle
+    const sf::View& view = target.getView();
+    const sf::Vector2f center = view.getCenter();
+    const sf::Vector2f viewSize = view.getSize();
+    const float chunkPixels = ChunkedTileMap::CHUNK_SIZE * tileSize;
+    const int firstX = std::max(0, static_cast<int>(std::floor((center.x - viewSize.x / 2.0f) / chunkPixels)));
+    const int firstY = std::max(0, static_cast<int>(std::floor((center.y - viewSize.y / 2.0f) / chunkPixels)));
+    const int lastX = std::min(chunksX - 1, static_cast<int>(std::floor((center.x + viewSize.x / 2.0f) / chunkPixels)));
+    const int lastY = std::min(chunksY - 1, static_cast<int>(std::floor((center.y + viewSize.y / 2.0f) / chunkPixels)));
+    
+    for (int chunkY = firstY; chunkY <= lastY; chunkY++) {
+        for (int chunkX = firstX; chunkX <= lastX; chunkX++) {
+            const int index = chunkY * chunksX + chunkX;
+            ChunkMesh& mesh = meshes[index];
+            if (!mesh.built) {
+                build(mesh, map, chunkX, chunkY);
+            }
+            mesh.lastDrawnFrame = frame;
+            touch(index);
+            
+            for (size_t layer = 0; layer < LAYER_COUNT; layer++) {
+                if (mesh.layers[layer].getVertexCount() == 0) continue;
+                
+                sf::RenderStates states;
+                if (layer < TextureSlotCount) {
+                    states.texture = textures[layer];
+                } else if (layer == SPARKLE_LAYER) {
+                    states.texture = sparkleTexture;
+                }
+                target.draw(mesh.layers[layer], states);
+                lastDrawCalls++;
+            }
+        }
+    }
+    
+    trimToBudget();
+}
+
+void TileMapRenderer::drawFog(sf::RenderTarget& target, const FieldOfView& sight, float tileSize) {
+    if (tileSize <= 0.0f) return;
+    
+    const sf::View& view = target.getView();
+    const sf::Vector2f center = view.getCenter();
+    const sf::Vector2f viewSize = view.getSize();
+    const int firstX = std::max(0, static_cast<int>(std::floor((center.x - viewSize.x / 2.0f) / tileSize)));
+    const int firstY = std::max(0, static_cast<int>(std::floor((center.y - viewSize.y / 2.0f) / tileSize)));
+    const int lastX = std::min(sight.getWidth() - 1, static_cast<int>(std::floor((center.x + viewSize.x / 2.0f) / tileSize)));
+    const int lastY = std::min(sight.getHeight() - 1, static_cast<int>(std::floor((center.y + viewSize.y / 2.0f) / tileSize)));
+    
+    // 0 = in sight, 1 = remembered, 2 = never seen
+    auto fogAt = [&](int x, int y) {
+        return sight.isVisible(x, y) ? 0 : sight.isExplored(x, y) ? 1 : 2;
+    };
+    const sf::Color shades[3] = {sf::Color::Transparent, sf::Color(0, 0, 0, 150), sf::Color(0, 0, 0, 255)};
+    
+    fog.setPrimitiveType(sf::PrimitiveType::Triangles);
+    fog.clear();
+    for (int y = firstY; y <= lastY; y++) {
+        int x = firstX;
+        while (x <= lastX) {
+            const int shade = fogAt(x, y);
+            int end = x + 1;
+            while (end <= lastX && fogAt(end, y) == shade) end++;
+            if (shade != 0) {
+                appendQuad(fog, x * tileSize, y * tileSize, (end - x) * tileSize, tileSize, shades[shade]);
+            }
+            x = end;
+        }
+    }
+    
+    if (fog.getVertexCount() > 0) {
+        target.draw(fog);
+    }
+}
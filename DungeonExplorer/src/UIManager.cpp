@@ -12,11 +12,15 @@
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
+#include <cmath>
 
 UIManager::UIManager(Game* game) 
     : game(game), fontLoaded(false), inventoryVisible(false), 
       skillTreeVisible(false), miniMapVisible(true), animationTime(0.f),
-      screenFlashTimer(0.f), screenFlashColor(sf::Color::Transparent) {
+      screenFlashTimer(0.f), screenFlashColor(sf::Color::Transparent),
+      miniMapCells(sf::PrimitiveType::Triangles), miniMapFloorId(0), miniMapLayoutVersion(0),
+      miniMapExploredVersion(0), miniMapCellTiles(1), miniMapCellPx(8.f) {
     dsaViz = std::make_unique<DSAVisualizer>();
 }
 
@@ -148,6 +152,10 @@ void UIManager::renderUI(sf::RenderWindow& window, const Player& player,
                           const Dungeon& dungeon, const EnemyManager& enemies, SkillTree* skillTree, int currentFloor) {
     const float tileSize = 32.f;
     
+    // CHANGE: 2026-10-16 - Called with the scrolling game view active: world-space effects use
+    // it, panels switch to the window's default view. Returns with the default view set.
+    const sf::View worldView = window.getView();
+    
     // Render stack trail and other DSA effects (NOT graph paths - already rendered)
     if (dsaViz) {
         dsaViz->renderStackTrail(window, player, tileSize);
@@ -162,6 +170,7 @@ void UIManager::renderUI(sf::RenderWindow& window, const Player& player,
     }
     
     // Always render HUD
+    window.setView(window.getDefaultView());
     renderHUD(window, player, skillTree, currentFloor);
     
     // Render optional panels
@@ -184,10 +193,12 @@ void UIManager::renderUI(sf::RenderWindow& window, const Player& player,
     renderSkillHotkeys(window, player, skillTree);
     
     // TASK C: Render character names above sprites
-    renderCharacterNames(window, player, enemies, tileSize);
+    window.setView(worldView);
+    renderCharacterNames(window, player, enemies, tileSize, dungeon.getFieldOfView());
     
     // Render combat feedback (on top of everything)
     renderFloatingTexts(window);
+    window.setView(window.getDefaultView());
     renderScreenFlash(window);
 }
 
@@ -230,7 +241,8 @@ void UIManager::renderScreenFlash(sf::RenderWindow& window) {
 }
 
 // TASK C: Character names (floating labels above sprites)
-void UIManager::renderCharacterNames(sf::RenderWindow& window, const Player& player, const EnemyManager& enemies, float tileSize) {
+void UIManager::renderCharacterNames(sf::RenderWindow& window, const Player& player, const EnemyManager& enemies, float tileSize,
+                                     const FieldOfView& sight) {
     if (!fontLoaded) return;
     
     // Render player name
@@ -248,9 +260,19 @@ void UIManager::renderCharacterNames(sf::RenderWindow& window, const Player& pla
     window.draw(playerName);
     
     // Render enemy names
+    // CHANGE: 2026-10-16 - Only for enemies the camera can see (with slack for the label width)
+    const sf::Vector2f viewCenter = window.getView().getCenter();
+    const sf::Vector2f viewHalfSize = window.getView().getSize() / 2.f;
     for (const auto& enemy : enemies.getEnemies()) {
         float enemyX = enemy.x * tileSize + tileSize / 2.f;
         float enemyY = enemy.y * tileSize - tileSize / 3.f;
+        if (std::abs(enemyX - viewCenter.x) > viewHalfSize.x + 2.f * tileSize ||
+            std::abs(enemyY - viewCenter.y) > viewHalfSize.y + 2.f * tileSize) {
+            continue;
+        }
+        if (sight.isComputed() && !sight.isVisible(enemy.x, enemy.y)) {
+            continue;  // Hidden by the fog of war
+        }
         
         sf::Text enemyName(font, enemy.name, 10);
         // Color based on enemy type
@@ -274,7 +296,9 @@ void UIManager::renderCharacterNames(sf::RenderWindow& window, const Player& pla
 void UIManager::renderContextualPrompt(sf::RenderWindow& window, const std::string& prompt) {
     if (!fontLoaded || prompt.empty()) return;
     
-    // Draw prompt at bottom-center of screen
+    // Draw prompt at bottom-center of screen (in window pixels, whatever view the caller had)
+    const sf::View callerView = window.getView();
+    window.setView(window.getDefaultView());
     sf::Text promptText(font, prompt, 16);
     promptText.setFillColor(sf::Color(255, 255, 100));
     promptText.setOutlineThickness(2.f);
@@ -295,6 +319,7 @@ void UIManager::renderContextualPrompt(sf::RenderWindow& window, const std::stri
     
     promptText.setPosition(sf::Vector2f(centerX, bottomY));
     window.draw(promptText);
+    window.setView(callerView);
 }
 
 
@@ -521,22 +546,23 @@ void UIManager::renderMiniMap(sf::RenderWindow& window, const Dungeon& dungeon,
     // Light grey tiles (70, 70, 90) represent walkable areas
     // ═══════════════════════════════════════════════════════════════════════
     
-    // Draw simplified dungeon (scale down)
-    float scale = 8.0f;  // Each tile is 8x8 pixels on mini-map
+    // CHANGE: 2026-10-16 - Whole floor scaled into the panel, drawn as one cached vertex array
+    // (was one RectangleShape per tile, clipped to the top-left 20x20 tiles)
     float offsetX = 625.f;
     float offsetY = 445.f;
     
-    for (int y = 0; y < dungeon.getHeight() && y < 20; y++) {
-        for (int x = 0; x < dungeon.getWidth() && x < 20; x++) {
-            sf::RectangleShape miniTile({scale - 1.f, scale - 1.f});
-            miniTile.setPosition(sf::Vector2f(offsetX + x * scale, offsetY + y * scale));
-            
-            // Improved contrast - darker floor tiles
-            miniTile.setFillColor(sf::Color(70, 70, 90));  // Slightly brighter than background
-            window.draw(miniTile);
-        }
+    const FieldOfView& sight = dungeon.getFieldOfView();
+    if (miniMapFloorId != dungeon.getFloorId() || miniMapLayoutVersion != dungeon.getLayoutVersion() ||
+        miniMapExploredVersion != sight.getExploredVersion()) {
+        rebuildMiniMap(dungeon);
     }
     
+    sf::RenderStates miniMapStates;
+    miniMapStates.transform.translate(sf::Vector2f(offsetX, offsetY));
+    window.draw(miniMapCells, miniMapStates);
+    
+    float scale = miniMapCellPx / miniMapCellTiles;  // Pixels per map tile, for the markers
+    
     // ═══════════════════════════════════════════════════════════════════════
     // MINI-MAP MARKERS
     // Red dots = enemies
@@ -546,6 +572,7 @@ void UIManager::renderMiniMap(sf::RenderWindow& window, const Dungeon& dungeon,
     // Draw enemy positions - bright red for visibility
     const auto& enemyList = enemies.getEnemies();
     for (const auto& enemy : enemyList) {
+        if (sight.isComputed() && !sight.isVisible(enemy.x, enemy.y)) continue;  // Only enemies in sight
         sf::CircleShape enemyDot(2.f);
         enemyDot.setPosition(sf::Vector2f(offsetX + enemy.x * scale - 2.f, 
                                           offsetY + enemy.y * scale - 2.f));
@@ -563,6 +590,69 @@ void UIManager::renderMiniMap(sf::RenderWindow& window, const Dungeon& dungeon,
     window.draw(playerDot);
 }
 
+void UIManager::rebuildMiniMap(const Dungeon& dungeon) {
+    const float MAP_AREA = 140.f;  // Panel space below the title
+    const ChunkedTileMap& map = dungeon.getTileMap();
+    const int span = std::max(1, std::max(map.width(), map.height()));
+    
+    // Several tiles share one cell on big floors; a cell is lit if any of its tiles is walkable
+    miniMapCellTiles = std::max(1, static_cast<int>(std::ceil(span / MAP_AREA)));
+    const int cellsX = (map.width() + miniMapCellTiles - 1) / miniMapCellTiles;
+    const int cellsY = (map.height() + miniMapCellTiles - 1) / miniMapCellTiles;
+    miniMapCellPx = std::min(8.f, MAP_AREA / std::max(cellsX, cellsY));
+    
+    // Walk words cover 64 tiles at once, and solid (unallocated) chunks are skipped entirely.
+    // CHANGE: 2026-10-16 - Once the player's sight is running, only explored tiles are shown
+    const FieldOfView& sight = dungeon.getFieldOfView();
+    std::vector<uint8_t> lit(static_cast<size_t>(cellsX) * cellsY, 0);
+    map.forEachChunk([&](int chunkX, int chunkY, const ChunkedTileMap::Chunk& chunk) {
+        for (int row = 0; row < ChunkedTileMap::CHUNK_SIZE; row++) {
+            const int y = chunkY * ChunkedTileMap::CHUNK_SIZE + row;
+            uint64_t word = chunk.walk[row];
+            if (sight.isComputed()) {
+                word &= sight.exploredWord(chunkX * ChunkedTileMap::CHUNK_SIZE, y);
+            }
+            if (word == 0) continue;
+            for (int bit = 0; bit < ChunkedTileMap::CHUNK_SIZE && word != 0; bit++, word >>= 1) {
+                if (word & 1) {
+                    const int x = chunkX * ChunkedTileMap::CHUNK_SIZE + bit;
+                    lit[(y / miniMapCellTiles) * cellsX + x / miniMapCellTiles] = 1;
+                }
+            }
+        }
+    });
+    
+    // Two triangles per lit cell, with a 1px gap between cells when they are big enough to show it
+    const float size = miniMapCellPx > 2.f ? miniMapCellPx - 1.f : miniMapCellPx;
+    const sf::Color cellColor(70, 70, 90);  // Slightly brighter than background
+    miniMapCells.clear();
+    auto corner = [&](sf::Vector2f position) {
+        sf::Vertex vertex;
+        vertex.position = position;
+        vertex.color = cellColor;
+        miniMapCells.append(vertex);
+    };
+    for (int cy = 0; cy < cellsY; cy++) {
+        for (int cx = 0; cx < cellsX; cx++) {
+            if (!lit[cy * cellsX + cx]) continue;
+            const sf::Vector2f topLeft(cx * miniMapCellPx, cy * miniMapCellPx);
+            const sf::Vector2f topRight(topLeft.x + size, topLeft.y);
+            const sf::Vector2f bottomLeft(topLeft.x, topLeft.y + size);
+            const sf::Vector2f bottomRight(topLeft.x + size, topLeft.y + size);
+            corner(topLeft);
+            corner(topRight);
+            corner(bottomLeft);
+            corner(bottomLeft);
+            corner(topRight);
+            corner(bottomRight);
+        }
+    }
+    
+    miniMapFloorId = dungeon.getFloorId();
+    miniMapLayoutVersion = dungeon.getLayoutVersion();
+    miniMapExploredVersion = sight.getExploredVersion();
+}
+
 void UIManager::renderInventoryPanel(sf::RenderWindow& window, const Player& player) {
     // Inventory panel background
     sf::RectangleShape invBg({350.f, 450.f});
@@ -1,11 +1,22 @@
 #include "Game.h"
+#include "Random.h"
 #include <iostream>
 #include <exception>
+#include <string>
 
-int main() {
+int main(int argc, char* argv[]) {
     try {
         std::cout << "Starting Dungeon Explorer..." << std::endl;
         
+        // --seed N replays a run exactly (floors, spawns, drops, combat rolls)
+        uint64_t seed = Random::seedFromClock();
+        for (int i = 1; i < argc; i++) {
+            if (std::string(argv[i]) == "--seed" && i + 1 < argc) {
+                seed = std::stoull(argv[++i]);
+            }
+        }
+        Random::getInstance().seed(seed);
+        
         Game game;
         game.run();
         